@@ -6,6 +6,9 @@ option(BUILD_QT_FRONTEND "Build the Qt frontend" ON)
 option(BUILD_REGTEST "Build regression test runner" OFF)
 option(BUILD_TESTS "Build unit tests" OFF)
 
+# Logging options.
+set(LOG_COMPILE_LEVEL "" CACHE STRING "Remove log messages above this level at compile time (Error/Warning/Info/Verbose/Dev/Debug/Trace)")
+
 if(LINUX OR BSD)
   option(ENABLE_X11 "Support X11 window system" ON)
   option(ENABLE_WAYLAND "Support Wayland window system" ON)
@@ -23,6 +23,9 @@ endif()
 if(BUILD_TESTS)
   message(STATUS "Building unit tests.")
 endif()
+if(LOG_COMPILE_LEVEL)
+  message(STATUS "Removing log messages above ${LOG_COMPILE_LEVEL} level.")
+endif()
 
 if(ALLOW_INSTALL)
   message(WARNING "Install target is enabled. This will install all DuckStation files into:
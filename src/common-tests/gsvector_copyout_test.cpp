@@ -0,0 +1,156 @@
+// SPDX-FileCopyrightText: 2019-2024 Connor McLaughlin <stenzek@gmail.com>
+// SPDX-License-Identifier: (GPL-3.0 OR CC-BY-NC-ND-4.0)
+
+#include "core/gpu_sw_copy_out.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+// Checks the GPU_SW display copy-out kernels against straightforward scalar conversions.
+
+namespace {
+static constexpr u32 VRAM_WIDTH = 1024;
+static constexpr u32 VRAM_HEIGHT = 16;
+} // namespace
+
+template<GPUTexture::Format format>
+static u32 VRAM16ToOutput_Scalar(u16 value)
+{
+  const u32 value32 = ZeroExtend32(value);
+  const u32 r = value32 & 31u;
+  const u32 g = (value32 >> 5) & 31u;
+  const u32 b = (value32 >> 10) & 31u;
+  if constexpr (format == GPUTexture::Format::RGBA5551)
+    return (r << 10) | (g << 5) | b;
+  else if constexpr (format == GPUTexture::Format::RGB565)
+    return (r << 11) | (g << 6) | b;
+  else if constexpr (format == GPUTexture::Format::RGBA8)
+    return (r << 3) | (g << 11) | (b << 19) | (((value32 >> 15) != 0) ? 0xFF000000u : 0u);
+  else
+    return (b << 3) | (g << 11) | (r << 19) | 0xFF000000u;
+}
+
+template<GPUTexture::Format format>
+static u32 VRAM24ToOutput_Scalar(const u8* src_ptr)
+{
+  const u32 r = src_ptr[0];
+  const u32 g = src_ptr[1];
+  const u32 b = src_ptr[2];
+  if constexpr (format == GPUTexture::Format::RGBA5551)
+    return ((r >> 3) << 10) | ((g >> 3) << 5) | (b >> 3);
+  else if constexpr (format == GPUTexture::Format::RGB565)
+    return ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3);
+  else if constexpr (format == GPUTexture::Format::RGBA8)
+    return r | (g << 8) | (b << 16) | 0xFF000000u;
+  else
+    return b | (g << 8) | (r << 16) | 0xFF000000u;
+}
+
+static std::vector<u16> GenerateVRAM()
+{
+  std::vector<u16> vram(VRAM_WIDTH * VRAM_HEIGHT);
+  u32 state = 0x12345678u;
+  for (u16& value : vram)
+  {
+    state = state * 1664525u + 1013904223u;
+    value = static_cast<u16>(state >> 16);
+  }
+
+  return vram;
+}
+
+template<GPUTexture::Format format, typename T>
+static void TestCopyOut15Bit()
+{
+  std::vector<u16> values(65536 + 7);
+  for (u32 i = 0; i < values.size(); i++)
+    values[i] = static_cast<u16>(i);
+
+  std::vector<T> dst_scalar(values.size());
+  std::vector<T> dst_vector(values.size());
+  for (u32 offset = 0; offset < 8; offset++)
+  {
+    const u32 width = 65536 - offset;
+    for (u32 i = 0; i < width; i++)
+      dst_scalar[i] = static_cast<T>(VRAM16ToOutput_Scalar<format>(values[offset + i]));
+    CopyOutRow16<format>(&values[offset], dst_vector.data(), width);
+    ASSERT_EQ(std::memcmp(dst_scalar.data(), dst_vector.data(), width * sizeof(T)), 0) << "offset=" << offset;
+  }
+}
+
+template<GPUTexture::Format format, typename T>
+static void TestCopyOut24Bit()
+{
+  const std::vector<u16> vram = GenerateVRAM();
+  std::vector<T> dst_scalar(VRAM_WIDTH * VRAM_HEIGHT);
+  std::vector<T> dst_vector(VRAM_WIDTH * VRAM_HEIGHT);
+
+  for (u32 line_skip = 0; line_skip < 2; line_skip++)
+  {
+    for (u32 skip_x = 0; skip_x < 2; skip_x++)
+    {
+      for (u32 width : {0u, 1u, 3u, 4u, 5u, 6u, 7u, 8u, 9u, 10u, 11u, 17u, 33u, 256u, 319u, 320u, 640u})
+      {
+        const u32 height = VRAM_HEIGHT >> line_skip;
+        const u32 src_stride = (VRAM_WIDTH << line_skip) * sizeof(u16);
+        const u8* src_ptr = reinterpret_cast<const u8*>(vram.data()) + (skip_x * 3);
+        std::fill(dst_scalar.begin(), dst_scalar.end(), static_cast<T>(0));
+        std::fill(dst_vector.begin(), dst_vector.end(), static_cast<T>(0));
+
+        for (u32 row = 0; row < height; row++)
+        {
+          const u8* src_row_ptr = src_ptr + row * src_stride;
+          for (u32 col = 0; col < width; col++)
+            dst_scalar[row * width + col] = static_cast<T>(VRAM24ToOutput_Scalar<format>(src_row_ptr + col * 3));
+          CopyOutRow24<format>(src_row_ptr, &dst_vector[row * width], width);
+        }
+
+        ASSERT_EQ(std::memcmp(dst_scalar.data(), dst_vector.data(), dst_scalar.size() * sizeof(T)), 0)
+          << "width=" << width << " skip_x=" << skip_x << " line_skip=" << line_skip;
+      }
+    }
+  }
+}
+
+TEST(GSVector, CopyOut15BitRGBA5551)
+{
+  TestCopyOut15Bit<GPUTexture::Format::RGBA5551, u16>();
+}
+
+TEST(GSVector, CopyOut15BitRGB565)
+{
+  TestCopyOut15Bit<GPUTexture::Format::RGB565, u16>();
+}
+
+TEST(GSVector, CopyOut15BitRGBA8)
+{
+  TestCopyOut15Bit<GPUTexture::Format::RGBA8, u32>();
+}
+
+TEST(GSVector, CopyOut15BitBGRA8)
+{
+  TestCopyOut15Bit<GPUTexture::Format::BGRA8, u32>();
+}
+
+TEST(GSVector, CopyOut24BitRGBA5551)
+{
+  TestCopyOut24Bit<GPUTexture::Format::RGBA5551, u16>();
+}
+
+TEST(GSVector, CopyOut24BitRGB565)
+{
+  TestCopyOut24Bit<GPUTexture::Format::RGB565, u16>();
+}
+
+TEST(GSVector, CopyOut24BitRGBA8)
+{
+  TestCopyOut24Bit<GPUTexture::Format::RGBA8, u32>();
+}
+
+TEST(GSVector, CopyOut24BitBGRA8)
+{
+  TestCopyOut24Bit<GPUTexture::Format::BGRA8, u32>();
+}
@@ -0,0 +1,123 @@
+// SPDX-FileCopyrightText: 2019-2024 Connor McLaughlin <stenzek@gmail.com>
+// SPDX-License-Identifier: (GPL-3.0 OR CC-BY-NC-ND-4.0)
+
+#include "common/task_scheduler.h"
+#include "common/threading.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <vector>
+
+namespace {
+class TaskSchedulerTest : public ::testing::Test
+{
+protected:
+  void TearDown() override
+  {
+    TaskScheduler::SetAffinityMask(0);
+    TaskScheduler::Shutdown();
+  }
+};
+} // namespace
+
+TEST_F(TaskSchedulerTest, WaitCompletesAllTasks)
+{
+  TaskScheduler::Initialize(4);
+
+  std::atomic<u32> counter{0};
+  TaskGroup group;
+  for (u32 i = 0; i < 1000; i++)
+    group.Submit([&counter]() { counter.fetch_add(1, std::memory_order_relaxed); });
+
+  group.Wait();
+  ASSERT_EQ(group.GetPendingCount(), 0u);
+  ASSERT_EQ(counter.load(), 1000u);
+}
+
+TEST_F(TaskSchedulerTest, WaitWithMaxPending)
+{
+  TaskScheduler::Initialize(2);
+
+  std::atomic_bool release{false};
+  std::atomic<u32> counter{0};
+  TaskGroup group;
+  for (u32 i = 0; i < 4; i++)
+  {
+    group.Submit([&release, &counter]() {
+      while (!release.load(std::memory_order_acquire))
+        Threading::Timeslice();
+      counter.fetch_add(1, std::memory_order_relaxed);
+    });
+  }
+
+  ASSERT_EQ(group.GetPendingCount(), 4u);
+  release.store(true, std::memory_order_release);
+  group.Wait(2);
+  ASSERT_LE(group.GetPendingCount(), 2u);
+  ASSERT_GE(counter.load(), 2u);
+
+  group.Wait();
+  ASSERT_EQ(counter.load(), 4u);
+}
+
+TEST_F(TaskSchedulerTest, ShutdownRunsQueuedTasks)
+{
+  TaskScheduler::Initialize(1);
+
+  std::atomic<u32> counter{0};
+  for (u32 i = 0; i < 100; i++)
+    TaskScheduler::Submit([&counter]() { counter.fetch_add(1, std::memory_order_relaxed); });
+
+  TaskScheduler::Shutdown();
+  ASSERT_EQ(counter.load(), 100u);
+  ASSERT_EQ(TaskScheduler::GetWorkerCount(), 0u);
+}
+
+TEST_F(TaskSchedulerTest, NestedSubmissionFromWorker)
+{
+  // With a single worker, waiting on the inner group can only finish if the worker runs the inner tasks itself.
+  TaskScheduler::Initialize(1);
+  ASSERT_FALSE(TaskScheduler::IsWorkerThread());
+
+  std::atomic<u32> inner_count{0};
+  std::atomic_bool outer_on_worker{false};
+  TaskGroup outer;
+  outer.Submit([&inner_count, &outer_on_worker]() {
+    outer_on_worker.store(TaskScheduler::IsWorkerThread());
+
+    TaskGroup inner;
+    for (u32 i = 0; i < 16; i++)
+      inner.Submit([&inner_count]() { inner_count.fetch_add(1, std::memory_order_relaxed); });
+
+    inner.Wait();
+  });
+
+  outer.Wait();
+  ASSERT_TRUE(outer_on_worker.load());
+  ASSERT_EQ(inner_count.load(), 16u);
+}
+
+TEST_F(TaskSchedulerTest, SetAffinityMask)
+{
+  // Not every platform can tell us which processor we're on.
+  const s32 processor = Threading::GetCurrentProcessorIndex();
+  if (processor < 0 || processor >= 64)
+    GTEST_SKIP() << "Current processor index is not available.";
+
+  TaskScheduler::Initialize(4);
+  TaskScheduler::SetAffinityMask(static_cast<u64>(1) << processor);
+
+  // Workers apply the mask before their next task, so the first batch makes sure every worker has seen it.
+  std::vector<s32> processors(64, -1);
+  for (u32 pass = 0; pass < 2; pass++)
+  {
+    TaskGroup group;
+    for (u32 i = 0; i < static_cast<u32>(processors.size()); i++)
+      group.Submit([&processors, i]() { processors[i] = Threading::GetCurrentProcessorIndex(); });
+    group.Wait();
+  }
+
+  for (const s32 task_processor : processors)
+    ASSERT_EQ(task_processor, processor);
+}
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: (GPL-3.0 OR CC-BY-NC-ND-4.0)
 
 #include "log.h"
+#include "align.h"
 #include "assert.h"
 #include "file_system.h"
 #include "small_string.h"
@@ -9,8 +10,14 @@
 
 #include "fmt/format.h"
 
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
 #include <cstdio>
+#include <cstring>
+#include <memory>
 #include <mutex>
+#include <thread>
 #include <vector>
 
 #if defined(_WIN32)
@@ -30,6 +37,56 @@ struct RegisteredCallback
   Log::CallbackFunctionType Function;
   void* Parameter;
 };
+
+// Immutable copy of the level and filter, so async writers can test messages without taking a lock.
+struct FilterState
+{
+  LOGLEVEL level;
+  std::string filter;
+};
+
+struct alignas(8) AsyncRecordHeader
+{
+  u32 size; // including header and alignment
+  u8 level;
+  bool padding;
+  u32 message_length;
+  Common::Timer::Value timestamp;
+  const char* channel_name;
+  const char* function_name;
+};
+
+// Single-producer single-consumer ring, owned by the thread which writes the messages.
+struct AsyncThreadBuffer
+{
+  static constexpr u32 SIZE = 64 * 1024;
+  static constexpr u32 MASK = SIZE - 1;
+  static constexpr u32 MAX_MESSAGE_LENGTH = (SIZE / 4) - sizeof(AsyncRecordHeader);
+
+  std::atomic<u64> write_pos{0};
+  std::atomic<u64> read_pos{0};
+  std::atomic_bool abandoned{false};
+  alignas(8) u8 data[SIZE];
+};
+
+struct AsyncThreadBufferOwner
+{
+  AsyncThreadBuffer* buffer = nullptr;
+
+  ~AsyncThreadBufferOwner()
+  {
+    // buffer is freed by the worker once it has been drained
+    if (buffer)
+      buffer->abandoned.store(true, std::memory_order_release);
+  }
+};
+
+struct AsyncOutputThread
+{
+  std::thread thread;
+
+  ~AsyncOutputThread();
+};
 } // namespace
 
 static void RegisterCallback(CallbackFunctionType callbackFunction, void* pUserParam,
@@ -37,6 +94,9 @@ static void RegisterCallback(CallbackFunctionType callbackFunction, void* pUserP
 static void UnregisterCallback(CallbackFunctionType callbackFunction, void* pUserParam,
                                const std::unique_lock<std::mutex>& lock);
 static bool FilterTest(LOGLEVEL level, const char* channelName, const std::unique_lock<std::mutex>& lock);
+static bool AsyncFilterTest(LOGLEVEL level, const char* channelName);
+static void UpdateChannelLevels(const std::unique_lock<std::mutex>& lock);
+static void PublishFilterState(const std::unique_lock<std::mutex>& lock);
 static void ExecuteCallbacks(const char* channelName, const char* functionName, LOGLEVEL level,
                              std::string_view message, const std::unique_lock<std::mutex>& lock);
 static void FormatLogMessageForDisplay(fmt::memory_buffer& buffer, const char* channelName, const char* functionName,
@@ -52,6 +112,12 @@ template<typename T>
 static void FormatLogMessageAndPrint(const char* channelName, const char* functionName, LOGLEVEL level,
                                      std::string_view message, bool timestamp, bool ansi_color_code, bool newline,
                                      const T& callback);
+static void QueueAsyncMessage(const char* channelName, const char* functionName, LOGLEVEL level,
+                              std::string_view message);
+static AsyncThreadBuffer* CreateAsyncThreadBuffer();
+static void AsyncOutputThreadEntryPoint();
+static void DrainAsyncBuffers(const std::unique_lock<std::mutex>& async_lock);
+static void StopAsyncOutputThread();
 #ifdef _WIN32
 template<typename T>
 static void FormatLogMessageAndPrintW(const char* channelName, const char* functionName, LOGLEVEL level,
@@ -66,14 +132,41 @@ static std::mutex s_callback_mutex;
 
 static Common::Timer::Value s_start_timestamp = Common::Timer::GetCurrentValue();
 
+static constinit const char* s_channel_names[MAX_CHANNELS] = {};
+static constinit std::atomic<u32> s_channel_count{1}; // 0 is reserved for channels that didn't fit
+
 static std::string s_log_filter;
 static LOGLEVEL s_log_level = LOGLEVEL_TRACE;
+
+// Async writers may still be reading an old state after it's replaced, so every state is kept. They're shared by
+// identical settings, and the filter only changes when settings are applied, so this stays tiny.
+static std::vector<std::unique_ptr<const FilterState>> s_filter_states;
+static std::atomic<const FilterState*> s_current_filter_state{nullptr};
+
 static bool s_console_output_enabled = false;
 static bool s_console_output_timestamps = true;
 static bool s_file_output_enabled = false;
 static bool s_file_output_timestamp = false;
 static bool s_debug_output_enabled = false;
 
+static constexpr auto ASYNC_DRAIN_INTERVAL = std::chrono::milliseconds(20);
+
+static std::atomic_bool s_async_output_enabled{false};
+static std::atomic<u64> s_async_dropped_messages{0};
+static u64 s_async_reported_dropped_messages = 0;
+static thread_local AsyncThreadBufferOwner s_async_thread_buffer;
+static thread_local const Common::Timer::Value* s_async_message_timestamp = nullptr;
+
+static std::mutex s_async_mutex;
+static std::condition_variable s_async_cv;
+static std::condition_variable s_async_flush_cv;
+static std::vector<std::unique_ptr<AsyncThreadBuffer>> s_async_buffers;
+static std::vector<const AsyncRecordHeader*> s_async_drain_records;
+static std::vector<u64> s_async_drain_end_positions;
+static u64 s_async_flush_request = 0;
+static u64 s_async_flush_completed = 0;
+static bool s_async_thread_shutdown = false;
+
 #ifdef _WIN32
 static HANDLE s_hConsoleStdIn = NULL;
 static HANDLE s_hConsoleStdOut = NULL;
@@ -81,6 +174,8 @@ static HANDLE s_hConsoleStdErr = NULL;
 #endif
 } // namespace Log
 
+constinit std::atomic<u8> Log::g_channel_levels[MAX_CHANNELS] = {};
+
 std::unique_ptr<std::FILE, void (*)(std::FILE*)> s_file_handle(nullptr, [](std::FILE* fp) {
   if (fp)
   {
@@ -88,6 +183,9 @@ std::unique_ptr<std::FILE, void (*)(std::FILE*)> s_file_handle(nullptr, [](std::
   }
 });
 
+// Declared after the file handle, so the final drain at exit still has somewhere to write.
+static Log::AsyncOutputThread s_async_output_thread;
+
 void Log::RegisterCallback(CallbackFunctionType callbackFunction, void* pUserParam)
 {
   std::unique_lock lock(s_callback_mutex);
@@ -125,7 +223,10 @@ void Log::UnregisterCallback(CallbackFunctionType callbackFunction, void* pUserP
 
 float Log::GetCurrentMessageTime()
 {
-  return static_cast<float>(Common::Timer::ConvertValueToSeconds(Common::Timer::GetCurrentValue() - s_start_timestamp));
+  // queued messages keep the time they were logged at, not when they were written out
+  const Common::Timer::Value timestamp =
+    s_async_message_timestamp ? *s_async_message_timestamp : Common::Timer::GetCurrentValue();
+  return static_cast<float>(Common::Timer::ConvertValueToSeconds(timestamp - s_start_timestamp));
 }
 
 bool Log::IsConsoleOutputEnabled()
@@ -413,7 +514,10 @@ void Log::FileOutputLogCallback(void* pUserParam, const char* channelName, const
 
   FormatLogMessageAndPrint(channelName, functionName, level, message, true, false, true, [](std::string_view message) {
     std::fwrite(message.data(), 1, message.size(), s_file_handle.get());
-    std::fflush(s_file_handle.get());
+
+    // the async worker flushes once per batch instead
+    if (!s_async_message_timestamp)
+      std::fflush(s_file_handle.get());
   });
 }
 
@@ -464,13 +568,46 @@ void Log::SetLogLevel(LOGLEVEL level)
   std::unique_lock lock(s_callback_mutex);
   DebugAssert(level < LOGLEVEL_COUNT);
   s_log_level = level;
+  UpdateChannelLevels(lock);
+  PublishFilterState(lock);
 }
 
 void Log::SetLogFilter(std::string_view filter)
 {
   std::unique_lock lock(s_callback_mutex);
   if (s_log_filter != filter)
+  {
     s_log_filter = filter;
+    UpdateChannelLevels(lock);
+    PublishFilterState(lock);
+  }
+}
+
+u32 Log::RegisterChannel(const char* channelName)
+{
+  // Called from static initializers, so only constant-initialized state can be touched here.
+  // The filter is applied when it's set, which happens after all channels have been registered.
+  g_channel_levels[0].store(static_cast<u8>(s_log_level), std::memory_order_relaxed);
+
+  const u32 id = s_channel_count.fetch_add(1, std::memory_order_acq_rel);
+  if (id >= MAX_CHANNELS) [[unlikely]]
+    return 0;
+
+  s_channel_names[id] = channelName;
+  g_channel_levels[id].store(static_cast<u8>(s_log_level), std::memory_order_relaxed);
+  return id;
+}
+
+void Log::UpdateChannelLevels(const std::unique_lock<std::mutex>& lock)
+{
+  const u32 count = std::min(s_channel_count.load(std::memory_order_acquire), MAX_CHANNELS);
+  g_channel_levels[0].store(static_cast<u8>(s_log_level), std::memory_order_relaxed);
+  for (u32 i = 1; i < count; i++)
+  {
+    const char* name = s_channel_names[i];
+    const LOGLEVEL level = (name && !FilterTest(s_log_level, name, lock)) ? LOGLEVEL_NONE : s_log_level;
+    g_channel_levels[i].store(static_cast<u8>(level), std::memory_order_relaxed);
+  }
 }
 
 ALWAYS_INLINE_RELEASE bool Log::FilterTest(LOGLEVEL level, const char* channelName,
@@ -479,8 +616,34 @@ ALWAYS_INLINE_RELEASE bool Log::FilterTest(LOGLEVEL level, const char* channelNa
   return (level <= s_log_level && s_log_filter.find(channelName) == std::string::npos);
 }
 
+void Log::PublishFilterState(const std::unique_lock<std::mutex>& lock)
+{
+  const auto iter = std::find_if(s_filter_states.begin(), s_filter_states.end(), [](const auto& state) {
+    return (state->level == s_log_level && state->filter == s_log_filter);
+  });
+  const FilterState* state =
+    (iter != s_filter_states.end()) ?
+      iter->get() :
+      s_filter_states.emplace_back(std::make_unique<const FilterState>(s_log_level, s_log_filter)).get();
+  s_current_filter_state.store(state, std::memory_order_release);
+}
+
+bool Log::AsyncFilterTest(LOGLEVEL level, const char* channelName)
+{
+  // Nothing published yet means the defaults, which let everything through.
+  const FilterState* state = s_current_filter_state.load(std::memory_order_acquire);
+  return (!state || (level <= state->level && state->filter.find(channelName) == std::string::npos));
+}
+
 void Log::Write(const char* channelName, LOGLEVEL level, std::string_view message)
 {
+  if (s_async_output_enabled.load(std::memory_order_relaxed))
+  {
+    if (AsyncFilterTest(level, channelName))
+      QueueAsyncMessage(channelName, nullptr, level, message);
+    return;
+  }
+
   std::unique_lock lock(s_callback_mutex);
   if (!FilterTest(level, channelName, lock))
     return;
@@ -490,6 +653,13 @@ void Log::Write(const char* channelName, LOGLEVEL level, std::string_view messag
 
 void Log::Write(const char* channelName, const char* functionName, LOGLEVEL level, std::string_view message)
 {
+  if (s_async_output_enabled.load(std::memory_order_relaxed))
+  {
+    if (AsyncFilterTest(level, channelName))
+      QueueAsyncMessage(channelName, functionName, level, message);
+    return;
+  }
+
   std::unique_lock lock(s_callback_mutex);
   if (!FilterTest(level, channelName, lock))
     return;
@@ -497,8 +667,48 @@ void Log::Write(const char* channelName, const char* functionName, LOGLEVEL leve
   ExecuteCallbacks(channelName, functionName, level, message, lock);
 }
 
+void Log::WriteChannel(const char* channelName, const char* functionName, LOGLEVEL level, std::string_view message)
+{
+  if (s_async_output_enabled.load(std::memory_order_relaxed))
+  {
+    QueueAsyncMessage(channelName, functionName, level, message);
+    return;
+  }
+
+  std::unique_lock lock(s_callback_mutex);
+  ExecuteCallbacks(channelName, functionName, level, message, lock);
+}
+
+void Log::WriteChannelFmtArgs(const char* channelName, const char* functionName, LOGLEVEL level, fmt::string_view fmt,
+                              fmt::format_args args)
+{
+  fmt::memory_buffer buffer;
+  fmt::vformat_to(std::back_inserter(buffer), fmt, args);
+
+  const std::string_view message(buffer.data(), buffer.size());
+  if (s_async_output_enabled.load(std::memory_order_relaxed))
+  {
+    QueueAsyncMessage(channelName, functionName, level, message);
+    return;
+  }
+
+  std::unique_lock lock(s_callback_mutex);
+  ExecuteCallbacks(channelName, functionName, level, message, lock);
+}
+
 void Log::WriteFmtArgs(const char* channelName, LOGLEVEL level, fmt::string_view fmt, fmt::format_args args)
 {
+  if (s_async_output_enabled.load(std::memory_order_relaxed))
+  {
+    if (!AsyncFilterTest(level, channelName))
+      return;
+
+    fmt::memory_buffer buffer;
+    fmt::vformat_to(std::back_inserter(buffer), fmt, args);
+    QueueAsyncMessage(channelName, nullptr, level, std::string_view(buffer.data(), buffer.size()));
+    return;
+  }
+
   std::unique_lock lock(s_callback_mutex);
   if (!FilterTest(level, channelName, lock))
     return;
@@ -512,6 +722,17 @@ void Log::WriteFmtArgs(const char* channelName, LOGLEVEL level, fmt::string_view
 void Log::WriteFmtArgs(const char* channelName, const char* functionName, LOGLEVEL level, fmt::string_view fmt,
                        fmt::format_args args)
 {
+  if (s_async_output_enabled.load(std::memory_order_relaxed))
+  {
+    if (!AsyncFilterTest(level, channelName))
+      return;
+
+    fmt::memory_buffer buffer;
+    fmt::vformat_to(std::back_inserter(buffer), fmt, args);
+    QueueAsyncMessage(channelName, functionName, level, std::string_view(buffer.data(), buffer.size()));
+    return;
+  }
+
   std::unique_lock lock(s_callback_mutex);
   if (!FilterTest(level, channelName, lock))
     return;
@@ -521,3 +742,215 @@ void Log::WriteFmtArgs(const char* channelName, const char* functionName, LOGLEV
 
   ExecuteCallbacks(channelName, functionName, level, std::string_view(buffer.data(), buffer.size()), lock);
 }
+
+bool Log::IsAsyncOutputEnabled()
+{
+  return s_async_output_enabled.load(std::memory_order_relaxed);
+}
+
+void Log::SetAsyncOutputEnabled(bool enabled)
+{
+  std::unique_lock lock(s_async_mutex);
+  if (s_async_output_thread.thread.joinable() == enabled)
+    return;
+
+  if (enabled)
+  {
+    s_async_thread_shutdown = false;
+    s_async_output_thread.thread = std::thread(&Log::AsyncOutputThreadEntryPoint);
+    s_async_output_enabled.store(true, std::memory_order_release);
+  }
+  else
+  {
+    lock.unlock();
+    StopAsyncOutputThread();
+  }
+}
+
+void Log::FlushAsyncOutput()
+{
+  std::unique_lock lock(s_async_mutex);
+  if (!s_async_output_thread.thread.joinable())
+    return;
+
+  const u64 request = ++s_async_flush_request;
+  s_async_cv.notify_one();
+  s_async_flush_cv.wait(lock, [request]() { return (s_async_flush_completed >= request); });
+}
+
+u64 Log::GetAsyncDroppedMessageCount()
+{
+  return s_async_dropped_messages.load(std::memory_order_relaxed);
+}
+
+Log::AsyncOutputThread::~AsyncOutputThread()
+{
+  StopAsyncOutputThread();
+}
+
+void Log::StopAsyncOutputThread()
+{
+  std::unique_lock lock(s_async_mutex);
+  if (!s_async_output_thread.thread.joinable())
+    return;
+
+  s_async_output_enabled.store(false, std::memory_order_release);
+  s_async_thread_shutdown = true;
+  s_async_cv.notify_one();
+  lock.unlock();
+
+  s_async_output_thread.thread.join();
+
+  // pick up anything which raced with the shutdown
+  lock.lock();
+  DrainAsyncBuffers(lock);
+}
+
+Log::AsyncThreadBuffer* Log::CreateAsyncThreadBuffer()
+{
+  std::unique_lock lock(s_async_mutex);
+  AsyncThreadBuffer* buffer = s_async_buffers.emplace_back(std::make_unique<AsyncThreadBuffer>()).get();
+  s_async_thread_buffer.buffer = buffer;
+  return buffer;
+}
+
+void Log::QueueAsyncMessage(const char* channelName, const char* functionName, LOGLEVEL level,
+                            std::string_view message)
+{
+  AsyncThreadBuffer* buffer = s_async_thread_buffer.buffer;
+  if (!buffer) [[unlikely]]
+    buffer = CreateAsyncThreadBuffer();
+
+  message = message.substr(0, AsyncThreadBuffer::MAX_MESSAGE_LENGTH);
+
+  const u32 size = Common::AlignUpPow2(static_cast<u32>(sizeof(AsyncRecordHeader) + message.size()), 8);
+  u64 write_pos = buffer->write_pos.load(std::memory_order_relaxed);
+  const u64 read_pos = buffer->read_pos.load(std::memory_order_acquire);
+  const u32 offset = static_cast<u32>(write_pos) & AsyncThreadBuffer::MASK;
+  const u32 contiguous = AsyncThreadBuffer::SIZE - offset;
+  const u32 padding = (contiguous < size) ? contiguous : 0;
+  const u32 used = static_cast<u32>(write_pos - read_pos);
+  if ((AsyncThreadBuffer::SIZE - used) < (size + padding)) [[unlikely]]
+  {
+    s_async_dropped_messages.fetch_add(1, std::memory_order_relaxed);
+    s_async_cv.notify_one();
+    return;
+  }
+
+  if (padding > 0)
+  {
+    // records never wrap, skip to the start of the ring
+    AsyncRecordHeader* hdr = reinterpret_cast<AsyncRecordHeader*>(&buffer->data[offset]);
+    hdr->size = padding;
+    hdr->padding = true;
+    write_pos += padding;
+  }
+
+  AsyncRecordHeader* hdr =
+    reinterpret_cast<AsyncRecordHeader*>(&buffer->data[static_cast<u32>(write_pos) & AsyncThreadBuffer::MASK]);
+  hdr->size = size;
+  hdr->level = static_cast<u8>(level);
+  hdr->padding = false;
+  hdr->message_length = static_cast<u32>(message.size());
+  hdr->timestamp = Common::Timer::GetCurrentValue();
+  hdr->channel_name = channelName;
+  hdr->function_name = functionName;
+  std::memcpy(hdr + 1, message.data(), message.size());
+  buffer->write_pos.store(write_pos + size, std::memory_order_release);
+
+  // don't wait for the next interval for errors, or when we're at risk of dropping messages
+  if (level <= LOGLEVEL_ERROR || (used + size + padding) >= (AsyncThreadBuffer::SIZE / 2))
+    s_async_cv.notify_one();
+}
+
+void Log::AsyncOutputThreadEntryPoint()
+{
+  std::unique_lock lock(s_async_mutex);
+  while (!s_async_thread_shutdown)
+  {
+    s_async_cv.wait_for(lock, ASYNC_DRAIN_INTERVAL);
+
+    const u64 flush_request = s_async_flush_request;
+    DrainAsyncBuffers(lock);
+    if (s_async_flush_completed != flush_request)
+    {
+      s_async_flush_completed = flush_request;
+      s_async_flush_cv.notify_all();
+    }
+  }
+}
+
+void Log::DrainAsyncBuffers(const std::unique_lock<std::mutex>& async_lock)
+{
+  s_async_drain_records.clear();
+  s_async_drain_end_positions.clear();
+
+  for (const std::unique_ptr<AsyncThreadBuffer>& buffer : s_async_buffers)
+  {
+    u64 read_pos = buffer->read_pos.load(std::memory_order_relaxed);
+    const u64 write_pos = buffer->write_pos.load(std::memory_order_acquire);
+    while (read_pos != write_pos)
+    {
+      const AsyncRecordHeader* hdr =
+        reinterpret_cast<const AsyncRecordHeader*>(&buffer->data[static_cast<u32>(read_pos) & AsyncThreadBuffer::MASK]);
+      if (!hdr->padding)
+        s_async_drain_records.push_back(hdr);
+      read_pos += hdr->size;
+    }
+
+    s_async_drain_end_positions.push_back(read_pos);
+  }
+
+  const u64 dropped = s_async_dropped_messages.load(std::memory_order_relaxed);
+  if (!s_async_drain_records.empty() || dropped != s_async_reported_dropped_messages)
+  {
+    // merge the per-thread streams back into a single timeline
+    std::stable_sort(s_async_drain_records.begin(), s_async_drain_records.end(),
+                     [](const AsyncRecordHeader* lhs, const AsyncRecordHeader* rhs) {
+                       return (lhs->timestamp < rhs->timestamp);
+                     });
+
+    std::unique_lock lock(s_callback_mutex);
+    for (const AsyncRecordHeader* hdr : s_async_drain_records)
+    {
+      const LOGLEVEL level = static_cast<LOGLEVEL>(hdr->level);
+      if (!FilterTest(level, hdr->channel_name, lock))
+        continue;
+
+      s_async_message_timestamp = &hdr->timestamp;
+      ExecuteCallbacks(hdr->channel_name, hdr->function_name, level,
+                       std::string_view(reinterpret_cast<const char*>(hdr + 1), hdr->message_length), lock);
+    }
+    s_async_message_timestamp = nullptr;
+
+    if (dropped != s_async_reported_dropped_messages)
+    {
+      ExecuteCallbacks("Log", __FUNCTION__, LOGLEVEL_WARNING,
+                       TinyString::from_format("{} log messages were dropped, buffer was full",
+                                               dropped - s_async_reported_dropped_messages),
+                       lock);
+      s_async_reported_dropped_messages = dropped;
+    }
+
+    if (s_file_output_enabled)
+      std::fflush(s_file_handle.get());
+  }
+
+  for (size_t i = 0; i < s_async_buffers.size(); i++)
+    s_async_buffers[i]->read_pos.store(s_async_drain_end_positions[i], std::memory_order_release);
+
+  // threads which have exited can't write any more messages
+  for (auto iter = s_async_buffers.begin(); iter != s_async_buffers.end();)
+  {
+    AsyncThreadBuffer* buffer = iter->get();
+    if (buffer->abandoned.load(std::memory_order_acquire) &&
+        buffer->read_pos.load(std::memory_order_relaxed) == buffer->write_pos.load(std::memory_order_acquire))
+    {
+      iter = s_async_buffers.erase(iter);
+    }
+    else
+    {
+      ++iter;
+    }
+  }
+}
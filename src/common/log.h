@@ -7,6 +7,7 @@
 
 #include "fmt/core.h"
 
+#include <atomic>
 #include <cinttypes>
 #include <cstdarg>
 #include <mutex>
@@ -26,7 +27,23 @@ enum LOGLEVEL
   LOGLEVEL_COUNT
 };
 
+// Messages above this level are removed at compile time, along with the evaluation of their arguments.
+// Numeric so that it can be tested by the preprocessor, matches the LOGLEVEL enum.
+#ifndef LOG_COMPILE_LEVEL
+#ifdef _DEBUG
+#define LOG_COMPILE_LEVEL 7 // LOGLEVEL_TRACE
+#else
+#define LOG_COMPILE_LEVEL 5 // LOGLEVEL_DEV
+#endif
+#endif
+
 namespace Log {
+// maximum number of Log_SetChannel() sites, any beyond this share the global level
+static constexpr u32 MAX_CHANNELS = 512;
+
+// highest visible level for each registered channel, combining the global level and filter
+extern std::atomic<u8> g_channel_levels[MAX_CHANNELS];
+
 // log message callback type
 using CallbackFunctionType = void (*)(void* pUserParam, const char* channelName, const char* functionName,
                                       LOGLEVEL level, std::string_view message);
@@ -51,6 +68,16 @@ void SetDebugOutputParams(bool enabled);
 // adds a file output
 void SetFileOutputParams(bool enabled, const char* filename, bool timestamps = true);
 
+// enables asynchronous output, messages are queued per-thread and written to the sinks by a worker thread
+bool IsAsyncOutputEnabled();
+void SetAsyncOutputEnabled(bool enabled);
+
+// blocks until all queued asynchronous messages have been written to the sinks
+void FlushAsyncOutput();
+
+// returns the number of asynchronous messages dropped because the producing thread's buffer was full
+u64 GetAsyncDroppedMessageCount();
+
 // Returns the current global filtering level.
 LOGLEVEL GetLogLevel();
 
@@ -63,6 +90,15 @@ void SetLogLevel(LOGLEVEL level);
 // Sets global filter, any messages from these channels won't be sent to any of the logging sinks.
 void SetLogFilter(std::string_view filter);
 
+// Allocates a channel ID for a Log_SetChannel() site. Safe to call during static initialization.
+u32 RegisterChannel(const char* channelName);
+
+// Returns true if messages at the specified level in this channel would be visible.
+ALWAYS_INLINE static bool IsChannelLevelEnabled(u32 channelId, LOGLEVEL level)
+{
+  return (static_cast<u8>(level) <= g_channel_levels[channelId].load(std::memory_order_relaxed));
+}
+
 // writes a message to the log
 void Write(const char* channelName, LOGLEVEL level, std::string_view message);
 void Write(const char* channelName, const char* functionName, LOGLEVEL level, std::string_view message);
@@ -94,27 +130,75 @@ ALWAYS_INLINE static void FastWrite(const char* channelName, const char* functio
   if (level <= GetLogLevel()) [[unlikely]]
     WriteFmtArgs(channelName, functionName, level, fmt, fmt::make_format_args(args...));
 }
+
+// writes a message from a channel which has already been tested with IsChannelLevelEnabled()
+void WriteChannel(const char* channelName, const char* functionName, LOGLEVEL level, std::string_view message);
+void WriteChannelFmtArgs(const char* channelName, const char* functionName, LOGLEVEL level, fmt::string_view fmt,
+                         fmt::format_args args);
+
+ALWAYS_INLINE static void ChannelWrite(const char* channelName, const char* functionName, LOGLEVEL level,
+                                       std::string_view message)
+{
+  WriteChannel(channelName, functionName, level, message);
+}
+template<typename... T>
+ALWAYS_INLINE static void ChannelWrite(const char* channelName, const char* functionName, LOGLEVEL level,
+                                       fmt::format_string<T...> fmt, T&&... args)
+{
+  WriteChannelFmtArgs(channelName, functionName, level, fmt, fmt::make_format_args(args...));
+}
 } // namespace Log
 
 // log wrappers
-#define Log_SetChannel(ChannelName) [[maybe_unused]] static const char* ___LogChannel___ = #ChannelName;
-
-#define ERROR_LOG(...) Log::FastWrite(___LogChannel___, __func__, LOGLEVEL_ERROR, __VA_ARGS__)
-#define WARNING_LOG(...) Log::FastWrite(___LogChannel___, __func__, LOGLEVEL_WARNING, __VA_ARGS__)
-#define INFO_LOG(...) Log::FastWrite(___LogChannel___, LOGLEVEL_INFO, __VA_ARGS__)
-#define VERBOSE_LOG(...) Log::FastWrite(___LogChannel___, LOGLEVEL_VERBOSE, __VA_ARGS__)
-#define DEV_LOG(...) Log::FastWrite(___LogChannel___, LOGLEVEL_DEV, __VA_ARGS__)
+#define Log_SetChannel(ChannelName)                                                                                    \
+  [[maybe_unused]] static const char* ___LogChannel___ = #ChannelName;                                                 \
+  [[maybe_unused]] static const u32 ___LogChannelId___ = Log::RegisterChannel(#ChannelName);
 
-#ifdef _DEBUG
-#define DEBUG_LOG(...) Log::FastWrite(___LogChannel___, LOGLEVEL_DEBUG, __VA_ARGS__)
-#define TRACE_LOG(...) Log::FastWrite(___LogChannel___, LOGLEVEL_TRACE, __VA_ARGS__)
-#else
-#define DEBUG_LOG(...)                                                                                                 \
+// arguments are only evaluated if the channel is enabled at this level
+#define LOG_CHANNEL_WRITE(level, function_name, ...)                                                                   \
   do                                                                                                                   \
   {                                                                                                                    \
+    if (Log::IsChannelLevelEnabled(___LogChannelId___, level)) [[unlikely]]                                            \
+      Log::ChannelWrite(___LogChannel___, function_name, level, __VA_ARGS__);                                          \
   } while (0)
-#define TRACE_LOG(...)                                                                                                 \
+
+#define LOG_COMPILED_OUT(...)                                                                                          \
   do                                                                                                                   \
   {                                                                                                                    \
   } while (0)
+
+#if LOG_COMPILE_LEVEL >= 1
+#define ERROR_LOG(...) LOG_CHANNEL_WRITE(LOGLEVEL_ERROR, __func__, __VA_ARGS__)
+#else
+#define ERROR_LOG(...) LOG_COMPILED_OUT(__VA_ARGS__)
+#endif
+#if LOG_COMPILE_LEVEL >= 2
+#define WARNING_LOG(...) LOG_CHANNEL_WRITE(LOGLEVEL_WARNING, __func__, __VA_ARGS__)
+#else
+#define WARNING_LOG(...) LOG_COMPILED_OUT(__VA_ARGS__)
+#endif
+#if LOG_COMPILE_LEVEL >= 3
+#define INFO_LOG(...) LOG_CHANNEL_WRITE(LOGLEVEL_INFO, nullptr, __VA_ARGS__)
+#else
+#define INFO_LOG(...) LOG_COMPILED_OUT(__VA_ARGS__)
+#endif
+#if LOG_COMPILE_LEVEL >= 4
+#define VERBOSE_LOG(...) LOG_CHANNEL_WRITE(LOGLEVEL_VERBOSE, nullptr, __VA_ARGS__)
+#else
+#define VERBOSE_LOG(...) LOG_COMPILED_OUT(__VA_ARGS__)
+#endif
+#if LOG_COMPILE_LEVEL >= 5
+#define DEV_LOG(...) LOG_CHANNEL_WRITE(LOGLEVEL_DEV, nullptr, __VA_ARGS__)
+#else
+#define DEV_LOG(...) LOG_COMPILED_OUT(__VA_ARGS__)
+#endif
+#if LOG_COMPILE_LEVEL >= 6
+#define DEBUG_LOG(...) LOG_CHANNEL_WRITE(LOGLEVEL_DEBUG, nullptr, __VA_ARGS__)
+#else
+#define DEBUG_LOG(...) LOG_COMPILED_OUT(__VA_ARGS__)
+#endif
+#if LOG_COMPILE_LEVEL >= 7
+#define TRACE_LOG(...) LOG_CHANNEL_WRITE(LOGLEVEL_TRACE, nullptr, __VA_ARGS__)
+#else
+#define TRACE_LOG(...) LOG_COMPILED_OUT(__VA_ARGS__)
 #endif
@@ -7,7 +7,6 @@
 #include <cctype>
 #include <codecvt>
 #include <cstdio>
-#include <sstream>
 
 #ifndef __APPLE__
 #include <malloc.h> // alloca
@@ -171,11 +170,17 @@ std::optional<std::vector<u8>> StringUtil::DecodeHex(const std::string_view in)
 
 std::string StringUtil::EncodeHex(const u8* data, int length)
 {
-  std::stringstream ss;
+  static constexpr const char hex_digits[] = "0123456789abcdef";
+
+  std::string ret;
+  ret.resize(static_cast<size_t>(length) * 2);
   for (int i = 0; i < length; i++)
-    ss << std::hex << std::setfill('0') << std::setw(2) << static_cast<int>(data[i]);
+  {
+    ret[static_cast<size_t>(i) * 2] = hex_digits[data[i] >> 4];
+    ret[static_cast<size_t>(i) * 2 + 1] = hex_digits[data[i] & 0xF];
+  }
 
-  return ss.str();
+  return ret;
 }
 
 std::string_view StringUtil::StripWhitespace(const std::string_view str)
@@ -0,0 +1,287 @@
+// SPDX-FileCopyrightText: 2019-2024 Connor McLaughlin <stenzek@gmail.com>
+// SPDX-License-Identifier: (GPL-3.0 OR CC-BY-NC-ND-4.0)
+
+#include "task_scheduler.h"
+#include "assert.h"
+#include "log.h"
+#include "threading.h"
+
+#include "fmt/format.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <thread>
+#include <vector>
+
+Log_SetChannel(TaskScheduler);
+
+namespace TaskScheduler {
+
+static constexpr u32 NUM_PRIORITIES = static_cast<u32>(Priority::MaxCount);
+static constexpr u32 MAX_WORKERS = 32;
+
+namespace {
+struct Worker
+{
+  std::mutex mutex;
+  std::array<std::deque<Task>, NUM_PRIORITIES> queues;
+  Threading::Thread thread;
+  u32 affinity_generation = 0;
+};
+
+struct State
+{
+  std::mutex init_mutex;
+  std::vector<std::unique_ptr<Worker>> workers;
+
+  std::mutex wake_mutex;
+  std::condition_variable wake_cv;
+  std::atomic<u32> num_queued_tasks{0};
+  std::atomic<u32> next_worker{0};
+  std::atomic_bool initialized{false};
+  bool shutdown = false;
+
+  std::atomic<u64> affinity_mask{0};
+  std::atomic<u32> affinity_generation{0};
+};
+} // namespace
+
+static u32 GetDefaultWorkerCount();
+static void EnsureInitialized();
+static bool TryRunTask(u32 start_index, bool owned);
+static void WorkerThread(u32 index);
+
+static State s_state;
+static thread_local s32 t_worker_index = -1;
+
+} // namespace TaskScheduler
+
+u32 TaskScheduler::GetDefaultWorkerCount()
+{
+  // hardware_concurrency() can return zero if it doesn't know.
+  const u32 num_processors = std::max(std::thread::hardware_concurrency(), 1u);
+  return std::clamp(num_processors - 1, 1u, MAX_WORKERS);
+}
+
+void TaskScheduler::Initialize(u32 num_workers /* = 0 */)
+{
+  std::unique_lock lock(s_state.init_mutex);
+  if (s_state.initialized.load(std::memory_order_acquire))
+    return;
+
+  num_workers = (num_workers == 0) ? GetDefaultWorkerCount() : std::min(num_workers, MAX_WORKERS);
+  INFO_LOG("Starting {} task scheduler worker(s).", num_workers);
+
+  // Workers can steal from each other as soon as they start, so create all of them first.
+  s_state.shutdown = false;
+  s_state.workers.reserve(num_workers);
+  for (u32 i = 0; i < num_workers; i++)
+    s_state.workers.push_back(std::make_unique<Worker>());
+  for (u32 i = 0; i < num_workers; i++)
+    s_state.workers[i]->thread.Start([i]() { WorkerThread(i); });
+
+  s_state.initialized.store(true, std::memory_order_release);
+}
+
+void TaskScheduler::Shutdown()
+{
+  std::unique_lock lock(s_state.init_mutex);
+  if (!s_state.initialized.load(std::memory_order_acquire))
+    return;
+
+  {
+    std::unique_lock wake_lock(s_state.wake_mutex);
+    s_state.shutdown = true;
+    s_state.wake_cv.notify_all();
+  }
+
+  for (std::unique_ptr<Worker>& worker : s_state.workers)
+    worker->thread.Join();
+
+  DebugAssert(s_state.num_queued_tasks.load(std::memory_order_acquire) == 0);
+  s_state.workers.clear();
+  s_state.initialized.store(false, std::memory_order_release);
+}
+
+void TaskScheduler::EnsureInitialized()
+{
+  if (!s_state.initialized.load(std::memory_order_acquire)) [[unlikely]]
+    Initialize();
+}
+
+u32 TaskScheduler::GetWorkerCount()
+{
+  return s_state.initialized.load(std::memory_order_acquire) ? static_cast<u32>(s_state.workers.size()) : 0;
+}
+
+bool TaskScheduler::IsWorkerThread()
+{
+  return (t_worker_index >= 0);
+}
+
+void TaskScheduler::SetAffinityMask(u64 processor_mask)
+{
+  s_state.affinity_mask.store(processor_mask, std::memory_order_release);
+  s_state.affinity_generation.fetch_add(1, std::memory_order_acq_rel);
+}
+
+void TaskScheduler::Submit(Task task, Priority priority /* = Priority::Normal */)
+{
+  EnsureInitialized();
+
+  // Tasks submitted from a worker go to its own queue, so nested work stays warm in that core's cache.
+  const u32 num_workers = static_cast<u32>(s_state.workers.size());
+  const u32 index = (t_worker_index >= 0) ? static_cast<u32>(t_worker_index) :
+                                            (s_state.next_worker.fetch_add(1, std::memory_order_relaxed) % num_workers);
+  Worker& worker = *s_state.workers[index];
+  {
+    std::unique_lock lock(worker.mutex);
+    worker.queues[static_cast<size_t>(priority)].push_back(std::move(task));
+  }
+
+  // The count is only bumped after the task is visible, so a woken worker will always find something to take.
+  // Bumping it under the wake lock means a worker can't miss the notify between checking the count and sleeping.
+  {
+    std::unique_lock lock(s_state.wake_mutex);
+    s_state.num_queued_tasks.fetch_add(1, std::memory_order_release);
+  }
+  s_state.wake_cv.notify_one();
+}
+
+bool TaskScheduler::RunPendingTask()
+{
+  if (!s_state.initialized.load(std::memory_order_acquire))
+    return false;
+
+  const u32 start_index = (t_worker_index >= 0) ? static_cast<u32>(t_worker_index) : 0;
+  return TryRunTask(start_index, t_worker_index >= 0);
+}
+
+bool TaskScheduler::TryRunTask(u32 start_index, bool owned)
+{
+  if (s_state.num_queued_tasks.load(std::memory_order_acquire) == 0)
+    return false;
+
+  // The owner takes from the back of its queues, thieves take from the front, which is where the oldest work is.
+  const u32 num_workers = static_cast<u32>(s_state.workers.size());
+  for (u32 priority = 0; priority < NUM_PRIORITIES; priority++)
+  {
+    for (u32 i = 0; i < num_workers; i++)
+    {
+      Worker& worker = *s_state.workers[(start_index + i) % num_workers];
+      std::unique_lock lock(worker.mutex);
+      std::deque<Task>& queue = worker.queues[priority];
+      if (queue.empty())
+        continue;
+
+      Task task;
+      if (owned && i == 0)
+      {
+        task = std::move(queue.back());
+        queue.pop_back();
+      }
+      else
+      {
+        task = std::move(queue.front());
+        queue.pop_front();
+      }
+      lock.unlock();
+
+      s_state.num_queued_tasks.fetch_sub(1, std::memory_order_acq_rel);
+      task();
+      return true;
+    }
+  }
+
+  return false;
+}
+
+void TaskScheduler::WorkerThread(u32 index)
+{
+  Threading::SetNameOfCurrentThread(fmt::format("Task Worker {}", index).c_str());
+  t_worker_index = static_cast<s32>(index);
+
+  Worker& worker = *s_state.workers[index];
+  for (;;)
+  {
+    const u32 affinity_generation = s_state.affinity_generation.load(std::memory_order_acquire);
+    if (worker.affinity_generation != affinity_generation)
+    {
+      const u64 mask = s_state.affinity_mask.load(std::memory_order_acquire);
+      if (!Threading::ThreadHandle::GetForCallingThread().SetAffinity(mask))
+        WARNING_LOG("Failed to set affinity of worker {} to {:016X}", index, mask);
+      worker.affinity_generation = affinity_generation;
+    }
+
+    if (TryRunTask(index, true))
+      continue;
+
+    // Anything still queued at shutdown gets run first.
+    std::unique_lock lock(s_state.wake_mutex);
+    s_state.wake_cv.wait(lock, []() {
+      return (s_state.shutdown || s_state.num_queued_tasks.load(std::memory_order_acquire) > 0);
+    });
+    if (s_state.shutdown && s_state.num_queued_tasks.load(std::memory_order_acquire) == 0)
+      break;
+  }
+
+  t_worker_index = -1;
+}
+
+TaskGroup::TaskGroup() = default;
+
+TaskGroup::~TaskGroup()
+{
+  Wait();
+}
+
+u32 TaskGroup::GetPendingCount()
+{
+  std::unique_lock lock(m_mutex);
+  return m_pending;
+}
+
+void TaskGroup::Submit(TaskScheduler::Task task, TaskScheduler::Priority priority /* = Priority::Normal */)
+{
+  {
+    std::unique_lock lock(m_mutex);
+    m_pending++;
+  }
+
+  TaskScheduler::Submit(
+    [this, task = std::move(task)]() {
+      task();
+      TaskCompleted();
+    },
+    priority);
+}
+
+void TaskGroup::TaskCompleted()
+{
+  // Notify under the lock, otherwise the waiter could return and destroy the group before we're done with it.
+  std::unique_lock lock(m_mutex);
+  DebugAssert(m_pending > 0);
+  m_pending--;
+  m_cv.notify_all();
+}
+
+void TaskGroup::Wait(u32 max_pending /* = 0 */)
+{
+  // Blocking a worker could deadlock if every worker ends up waiting, so help out instead.
+  if (TaskScheduler::IsWorkerThread())
+  {
+    while (GetPendingCount() > max_pending)
+    {
+      if (!TaskScheduler::RunPendingTask())
+        Threading::Timeslice();
+    }
+
+    return;
+  }
+
+  std::unique_lock lock(m_mutex);
+  m_cv.wait(lock, [this, max_pending]() { return (m_pending <= max_pending); });
+}
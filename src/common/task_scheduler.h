@@ -0,0 +1,86 @@
+// SPDX-FileCopyrightText: 2019-2024 Connor McLaughlin <stenzek@gmail.com>
+// SPDX-License-Identifier: (GPL-3.0 OR CC-BY-NC-ND-4.0)
+
+#pragma once
+
+#include "types.h"
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+
+// --------------------------------------------------------------------------------------
+//  TaskScheduler
+// --------------------------------------------------------------------------------------
+// Process-wide pool of worker threads for short-lived background work. Each worker owns
+// a queue per priority, and idle workers steal from the others, so bursts submitted from
+// one thread still spread across the pool. Dedicated long-running threads (GPU, CD-ROM
+// readahead) should stay on their own Threading::Thread.
+//
+namespace TaskScheduler {
+
+enum class Priority : u8
+{
+  High,
+  Normal,
+  Low,
+  MaxCount
+};
+
+using Task = std::function<void()>;
+
+/// Starts the workers. Zero picks a count from the number of processors, leaving one for the caller.
+/// Submitting a task before initializing starts the pool with the default count.
+void Initialize(u32 num_workers = 0);
+
+/// Runs any tasks which are still queued, then stops the workers.
+void Shutdown();
+
+/// Returns the number of worker threads, or zero if the pool has not been started.
+u32 GetWorkerCount();
+
+/// Returns true if the calling thread is one of the pool's workers.
+bool IsWorkerThread();
+
+/// Restricts the workers to the specified processors, zero allows all processors. Applied by each worker before it
+/// runs its next task.
+void SetAffinityMask(u64 processor_mask);
+
+/// Queues a task. Higher priority tasks are always picked before lower priority tasks.
+void Submit(Task task, Priority priority = Priority::Normal);
+
+/// Runs a single queued task on the calling thread. Returns false if there was nothing to run.
+bool RunPendingTask();
+
+} // namespace TaskScheduler
+
+// --------------------------------------------------------------------------------------
+//  TaskGroup
+// --------------------------------------------------------------------------------------
+// Tracks a set of submitted tasks, so the caller can wait for them to finish. Waiting
+// on a worker thread runs other queued tasks instead of blocking the worker.
+//
+class TaskGroup
+{
+public:
+  TaskGroup();
+  ~TaskGroup();
+
+  TaskGroup(const TaskGroup&) = delete;
+  TaskGroup& operator=(const TaskGroup&) = delete;
+
+  /// Returns the number of tasks which have been submitted but not yet completed.
+  u32 GetPendingCount();
+
+  void Submit(TaskScheduler::Task task, TaskScheduler::Priority priority = TaskScheduler::Priority::Normal);
+
+  /// Blocks until no more than max_pending tasks are outstanding. Zero waits for all tasks to complete.
+  void Wait(u32 max_pending = 0);
+
+private:
+  void TaskCompleted();
+
+  std::mutex m_mutex;
+  std::condition_variable m_cv;
+  u32 m_pending = 0;
+};
@@ -3,7 +3,16 @@
 
 #include "threading.h"
 #include "assert.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
 #include <memory>
+#include <string_view>
+#include <thread>
+#include <vector>
 
 #if !defined(_WIN32) && !defined(__APPLE__)
 #ifndef _GNU_SOURCE
@@ -240,7 +249,8 @@ bool Threading::ThreadHandle::SetAffinity(u64 processor_mask) const
   if (processor_mask == 0)
     processor_mask = ~processor_mask;
 
-  return (SetThreadAffinityMask(GetCurrentThread(), (DWORD_PTR)processor_mask) != 0 || GetLastError() != ERROR_SUCCESS);
+  return (SetThreadAffinityMask((HANDLE)m_native_handle, (DWORD_PTR)processor_mask) != 0 ||
+          GetLastError() != ERROR_SUCCESS);
 #elif defined(__linux__)
   cpu_set_t set;
   CPU_ZERO(&set);
@@ -478,6 +488,234 @@ u64 Threading::GetThreadCpuTime()
 #endif
 }
 
+#ifdef __linux__
+
+static bool ReadSysfsString(const char* path, char* buf, size_t buf_size)
+{
+  std::FILE* fp = std::fopen(path, "rb");
+  if (!fp)
+    return false;
+
+  const size_t len = std::fread(buf, 1, buf_size - 1, fp);
+  std::fclose(fp);
+  buf[len] = 0;
+  return (len > 0);
+}
+
+static u32 ReadSysfsU32(const char* path)
+{
+  char buf[32];
+  return ReadSysfsString(path, buf, sizeof(buf)) ? static_cast<u32>(std::strtoul(buf, nullptr, 10)) : 0;
+}
+
+// Parses lists in the "0-3,8,10-11" format used throughout sysfs.
+static u64 ReadSysfsProcessorList(const char* path)
+{
+  char buf[256];
+  if (!ReadSysfsString(path, buf, sizeof(buf)))
+    return 0;
+
+  u64 mask = 0;
+  const char* ptr = buf;
+  while (*ptr >= '0' && *ptr <= '9')
+  {
+    char* end;
+    const u32 first = static_cast<u32>(std::strtoul(ptr, &end, 10));
+    u32 last = first;
+    if (*end == '-')
+      last = static_cast<u32>(std::strtoul(end + 1, &end, 10));
+    for (u32 i = first; i <= last && i < 64; i++)
+      mask |= (static_cast<u64>(1) << i);
+
+    ptr = (*end == ',') ? (end + 1) : end;
+  }
+
+  return mask;
+}
+
+#endif
+
+static void ProbeProcessorTopology(Threading::ProcessorTopology* topology)
+{
+  // Higher score is faster. Processors which all have the same score are treated as homogeneous.
+  std::array<u32, 64> scores = {};
+
+#if defined(_WIN32)
+  DWORD length = 0;
+  GetSystemCpuSetInformation(nullptr, 0, &length, GetCurrentProcess(), 0);
+  std::vector<u8> buffer(length);
+  if (length > 0 && GetSystemCpuSetInformation(reinterpret_cast<PSYSTEM_CPU_SET_INFORMATION>(buffer.data()), length,
+                                               &length, GetCurrentProcess(), 0))
+  {
+    std::array<u32, 64> core_indices = {};
+    for (DWORD offset = 0; offset < length;)
+    {
+      const SYSTEM_CPU_SET_INFORMATION* info = reinterpret_cast<const SYSTEM_CPU_SET_INFORMATION*>(&buffer[offset]);
+      offset += info->Size;
+      if (info->Type != CpuSetInformation || info->CpuSet.Group != 0 || info->CpuSet.LogicalProcessorIndex >= 64)
+        continue;
+
+      const u32 index = info->CpuSet.LogicalProcessorIndex;
+      topology->all_mask |= (static_cast<u64>(1) << index);
+      scores[index] = info->CpuSet.EfficiencyClass;
+      core_indices[index] = info->CpuSet.CoreIndex;
+    }
+
+    for (u32 i = 0; i < 64; i++)
+    {
+      for (u32 j = 0; j < 64; j++)
+      {
+        if ((topology->all_mask & (static_cast<u64>(1) << j)) && core_indices[i] == core_indices[j])
+          topology->sibling_masks[i] |= (static_cast<u64>(1) << j);
+      }
+    }
+  }
+#elif defined(__linux__)
+  // Intel hybrid parts expose the P-cores and E-cores as separate PMUs.
+  const u64 intel_core_mask = ReadSysfsProcessorList("/sys/devices/cpu_core/cpus");
+  const u64 intel_atom_mask = ReadSysfsProcessorList("/sys/devices/cpu_atom/cpus");
+
+  char path[128];
+  bool scored_by_frequency = false;
+  const long num_configured = std::min(sysconf(_SC_NPROCESSORS_CONF), 64L);
+  for (u32 i = 0; i < static_cast<u32>(num_configured); i++)
+  {
+    // cpu0 usually can't be taken offline, so doesn't have the file.
+    std::snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%u/online", i);
+    char online[4];
+    if (ReadSysfsString(path, online, sizeof(online)) && online[0] == '0')
+      continue;
+
+    const u64 bit = static_cast<u64>(1) << i;
+    topology->all_mask |= bit;
+
+    // ARM reports the relative performance of each core directly, otherwise fall back to the maximum clock.
+    if (intel_core_mask != 0 && intel_atom_mask != 0)
+    {
+      scores[i] = (intel_core_mask & bit) ? 2 : 1;
+    }
+    else
+    {
+      std::snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%u/cpu_capacity", i);
+      if ((scores[i] = ReadSysfsU32(path)) == 0)
+      {
+        std::snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%u/cpufreq/cpuinfo_max_freq", i);
+        scores[i] = ReadSysfsU32(path);
+        scored_by_frequency = true;
+      }
+    }
+
+    std::snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%u/topology/thread_siblings_list", i);
+    topology->sibling_masks[i] = ReadSysfsProcessorList(path) | bit;
+  }
+
+  // Identical cores can still have different maximum clocks, e.g. AMD preferred cores boost a few percent higher.
+  // Only treat a large gap as separate core types, anything within 20% of the fastest counts as a performance core.
+  if (scored_by_frequency)
+  {
+    u32 max_frequency = 0;
+    for (u32 i = 0; i < 64; i++)
+      max_frequency = std::max(max_frequency, scores[i]);
+
+    const u32 threshold = max_frequency - (max_frequency / 5);
+    for (u32 i = 0; i < 64; i++)
+    {
+      if (topology->all_mask & (static_cast<u64>(1) << i))
+        scores[i] = (scores[i] == 0 || scores[i] >= threshold) ? 2 : 1;
+    }
+  }
+#endif
+
+  // Nothing else tells us about the layout, treat every processor as equal and unshared.
+  if (topology->all_mask == 0)
+  {
+    const u32 count = std::clamp(std::thread::hardware_concurrency(), 1u, 64u);
+    topology->all_mask = (count == 64) ? ~static_cast<u64>(0) : ((static_cast<u64>(1) << count) - 1);
+  }
+
+  u32 min_score = std::numeric_limits<u32>::max();
+  u32 max_score = 0;
+  for (u32 i = 0; i < 64; i++)
+  {
+    if (!(topology->all_mask & (static_cast<u64>(1) << i)))
+      continue;
+
+    min_score = std::min(min_score, scores[i]);
+    max_score = std::max(max_score, scores[i]);
+    if (topology->sibling_masks[i] == 0)
+      topology->sibling_masks[i] = (static_cast<u64>(1) << i);
+  }
+
+  topology->num_processors = static_cast<u32>(std::popcount(topology->all_mask));
+  if (min_score == max_score)
+  {
+    topology->performance_mask = topology->all_mask;
+    return;
+  }
+
+  for (u32 i = 0; i < 64; i++)
+  {
+    const u64 bit = static_cast<u64>(1) << i;
+    if (!(topology->all_mask & bit))
+      continue;
+
+    if (scores[i] == max_score)
+      topology->performance_mask |= bit;
+    else if (scores[i] == min_score)
+      topology->efficiency_mask |= bit;
+  }
+}
+
+const Threading::ProcessorTopology& Threading::GetProcessorTopology()
+{
+  static const ProcessorTopology topology = []() {
+    ProcessorTopology ret = {};
+    ProbeProcessorTopology(&ret);
+    return ret;
+  }();
+  return topology;
+}
+
+s32 Threading::GetCurrentProcessorIndex()
+{
+#if defined(_WIN32)
+  PROCESSOR_NUMBER number;
+  GetCurrentProcessorNumberEx(&number);
+  return (number.Group == 0) ? static_cast<s32>(number.Number) : -1;
+#elif defined(__linux__)
+  return sched_getcpu();
+#else
+  return -1;
+#endif
+}
+
+u64 Threading::GetAllowedProcessorMask()
+{
+#if defined(_WIN32)
+  DWORD_PTR process_mask, system_mask;
+  if (!::GetProcessAffinityMask(GetCurrentProcess(), &process_mask, &system_mask))
+    return 0;
+
+  return static_cast<u64>(process_mask);
+#elif defined(__linux__)
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  if (sched_getaffinity(0, sizeof(set), &set) != 0)
+    return 0;
+
+  u64 mask = 0;
+  for (u32 i = 0; i < 64; i++)
+  {
+    if (CPU_ISSET(i, &set))
+      mask |= static_cast<u64>(1) << i;
+  }
+
+  return mask;
+#else
+  return 0;
+#endif
+}
+
 u64 Threading::GetThreadTicksPerSecond()
 {
 #if defined(_WIN32) && !defined(_M_ARM64)
@@ -10,6 +10,7 @@
 #include <semaphore.h>
 #endif
 
+#include <array>
 #include <atomic>
 #include <functional>
 
@@ -23,6 +24,29 @@ extern void SetNameOfCurrentThread(const char* name);
 // Releases a timeslice to other threads.
 extern void Timeslice();
 
+/// Describes which processors are fast and slow on heterogeneous (big.LITTLE/hybrid) CPUs. Masks use the same
+/// numbering as ThreadHandle::SetAffinity(), so only the first 64 processors are considered.
+struct ProcessorTopology
+{
+  u32 num_processors;
+  u64 all_mask;
+  u64 performance_mask; // fastest class of processors, same as all_mask on homogeneous systems
+  u64 efficiency_mask;  // slowest class of processors, zero on homogeneous systems
+  std::array<u64, 64> sibling_masks; // processors sharing a core with each processor, including itself
+
+  ALWAYS_INLINE bool IsHeterogeneous() const { return (efficiency_mask != 0); }
+};
+
+/// Probes the processor layout on the first call, later calls return the cached result.
+extern const ProcessorTopology& GetProcessorTopology();
+
+/// Returns the processor the calling thread is currently running on, or -1 if the OS can't tell us.
+extern s32 GetCurrentProcessorIndex();
+
+/// Returns the processors the calling thread is allowed to run on (the whole process on Windows), using the same
+/// numbering as ThreadHandle::SetAffinity(). Returns zero if the OS can't tell us.
+extern u64 GetAllowedProcessorMask();
+
 // --------------------------------------------------------------------------------------
 //  ThreadHandle
 // --------------------------------------------------------------------------------------
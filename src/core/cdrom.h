@@ -10,6 +10,10 @@
 class CDImage;
 class StateWrapper;
 
+namespace Threading {
+class Thread;
+}
+
 namespace CDROM {
 
 void Initialize();
@@ -41,6 +45,9 @@ void DrawDebugWindow();
 
 void SetReadaheadSectors(u32 readahead_sectors);
 
+/// Returns the readahead thread, or null if sectors are read on the CPU thread.
+const Threading::Thread* GetReadThread();
+
 /// Reads a frame from the audio FIFO, used by the SPU.
 std::tuple<s16, s16> GetAudioFrame();
 
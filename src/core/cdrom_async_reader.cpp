@@ -2,6 +2,8 @@
 // SPDX-License-Identifier: (GPL-3.0 OR CC-BY-NC-ND-4.0)
 
 #include "cdrom_async_reader.h"
+#include "frame_statistics.h"
+
 #include "common/assert.h"
 #include "common/log.h"
 #include "common/timer.h"
@@ -24,7 +26,7 @@ void CDROMAsyncReader::StartThread(u32 readahead_count)
   EmptyBuffers();
 
   m_shutdown_flag.store(false);
-  m_read_thread = std::thread(&CDROMAsyncReader::WorkerThreadEntryPoint, this);
+  m_read_thread.Start([this]() { WorkerThreadEntryPoint(); });
   INFO_LOG("Read thread started with readahead of {} sectors", readahead_count);
 }
 
@@ -39,7 +41,7 @@ void CDROMAsyncReader::StopThread()
     m_do_read_cv.notify_one();
   }
 
-  m_read_thread.join();
+  m_read_thread.Join();
   EmptyBuffers();
   m_buffers.clear();
 }
@@ -202,6 +204,8 @@ bool CDROMAsyncReader::WaitForReadToComplete()
   }
 
   const u32 front = m_buffer_front.load();
+  FrameStatistics::AddStallTime(FrameStatistics::StallCause::DiscReadWait,
+                                Common::Timer::GetCurrentValue() - wait_timer.GetStartValue());
   const double wait_time = wait_timer.GetTimeMilliseconds();
   if (wait_time > 1.0f) [[unlikely]]
     WARNING_LOG("Had to wait {:.2f} msec for LBA {}", wait_time, m_buffers[front].lba);
@@ -261,6 +265,7 @@ bool CDROMAsyncReader::ReadSectorIntoBuffer(std::unique_lock<std::mutex>& lock)
 
 void CDROMAsyncReader::ReadSectorNonThreaded(CDImage::LBA lba)
 {
+  const FrameStatistics::ScopedStall stall(FrameStatistics::StallCause::DiscReadWait);
   Common::Timer timer;
 
   m_buffers.resize(1);
@@ -4,10 +4,13 @@
 #pragma once
 #include "util/cd_image.h"
 #include "types.h"
+
+#include "common/threading.h"
+
 #include <array>
 #include <atomic>
 #include <condition_variable>
-#include <thread>
+#include <mutex>
 
 class ProgressCallback;
 
@@ -39,7 +42,8 @@ public:
   CDImage* GetMedia() { return m_media.get(); }
   const std::string& GetMediaFileName() const { return m_media->GetFileName(); }
 
-  bool IsUsingThread() const { return m_read_thread.joinable(); }
+  bool IsUsingThread() const { return m_read_thread.Joinable(); }
+  const Threading::Thread* GetReadThread() const { return IsUsingThread() ? &m_read_thread : nullptr; }
   void StartThread(u32 readahead_count = 8);
   void StopThread();
 
@@ -69,7 +73,7 @@ private:
   std::unique_ptr<CDImage> m_media;
 
   std::mutex m_mutex;
-  std::thread m_read_thread;
+  Threading::Thread m_read_thread;
   std::condition_variable m_do_read_cv;
   std::condition_variable m_notify_read_complete_cv;
 
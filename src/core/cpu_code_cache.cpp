@@ -7,6 +7,7 @@
 #include "cpu_core_private.h"
 #include "cpu_disasm.h"
 #include "cpu_recompiler_types.h"
+#include "frame_statistics.h"
 #include "host.h"
 #include "settings.h"
 #include "system.h"
@@ -240,6 +241,8 @@ void CPU::CodeCache::Shutdown()
 
 void CPU::CodeCache::Reset()
 {
+  const FrameStatistics::ScopedStall stall(FrameStatistics::StallCause::CodeCacheReset);
+
   ClearBlocks();
 
   if (IsUsingAnyRecompiler())
@@ -803,14 +803,22 @@ TickCount DMA::TransferMemoryToDevice(u32 address, u32 increment, u32 word_count
       if (g_gpu->BeginDMAWrite()) [[likely]]
       {
         u8* ram_pointer = Bus::g_ram;
-        for (u32 i = 0; i < word_count; i++)
+        if (increment == sizeof(u32) && (address + (word_count * sizeof(u32))) <= (mask + 1)) [[likely]]
         {
-          u32 value;
-          std::memcpy(&value, &ram_pointer[address], sizeof(u32));
-          g_gpu->DMAWrite(address, value);
-          address = (address + increment) & mask;
+          // Contiguous, let the GPU parse it in place.
+          g_gpu->DMAWriteBlock(address, &ram_pointer[address], word_count);
+        }
+        else
+        {
+          for (u32 i = 0; i < word_count; i++)
+          {
+            u32 value;
+            std::memcpy(&value, &ram_pointer[address], sizeof(u32));
+            g_gpu->DMAWrite(address, value);
+            address = (address + increment) & mask;
+          }
+          g_gpu->EndDMAWrite();
         }
-        g_gpu->EndDMAWrite();
       }
     }
     break;
@@ -0,0 +1,139 @@
+// SPDX-FileCopyrightText: 2019-2024 Connor McLaughlin <stenzek@gmail.com>
+// SPDX-License-Identifier: (GPL-3.0 OR CC-BY-NC-ND-4.0)
+
+#include "frame_pacer.h"
+
+#include "common/align.h"
+#include "common/bitutils.h"
+#include "common/log.h"
+
+#include <algorithm>
+#include <cmath>
+
+Log_SetChannel(FramePacer);
+
+// Weight of each new frame in the running mean/variance. 1/16 adapts within a quarter of a second at 60hz.
+static constexpr double SAMPLE_WEIGHT = 1.0 / 16.0;
+
+// Don't sleep in a phase until we have some idea of how long its frames take.
+static constexpr u32 WARMUP_SAMPLES = 30;
+
+// Margin is in standard deviations above the mean, adjusted after each window to hit the target miss rate.
+static constexpr u32 MISS_RATE_WINDOW = 300;
+static constexpr double INITIAL_MARGIN = 3.0;
+static constexpr double MIN_MARGIN = 1.0;
+static constexpr double MAX_MARGIN = 10.0;
+static constexpr double MARGIN_INCREASE_STEP = 1.0;
+static constexpr double MARGIN_DECREASE_STEP = 0.25;
+
+FramePacer::FramePacer()
+{
+  Reset();
+}
+
+void FramePacer::Reset()
+{
+  m_phases = {};
+  m_current_phase = &m_phases[0];
+  m_margin = INITIAL_MARGIN;
+  m_last_active_time = 0;
+  m_last_frame_missed = false;
+  m_window_frames = 0;
+  m_window_misses = 0;
+  m_total_frames = 0;
+  m_total_misses = 0;
+}
+
+void FramePacer::SetPhase(u32 key)
+{
+  if (m_current_phase->key == key && m_current_phase->num_samples > 0)
+    return;
+
+  PhaseModel* replace = &m_phases[0];
+  for (PhaseModel& phase : m_phases)
+  {
+    if (phase.key == key && phase.num_samples > 0)
+    {
+      m_current_phase = &phase;
+      return;
+    }
+
+    if (phase.num_samples == 0 || (replace->num_samples > 0 && phase.last_used_frame < replace->last_used_frame))
+      replace = &phase;
+  }
+
+  DEV_LOG("New frame pacing phase {:08X}", key);
+  *replace = {};
+  replace->key = key;
+  m_current_phase = replace;
+}
+
+void FramePacer::AddFrame(Common::Timer::Value active_time, Common::Timer::Value frame_period, bool missed_deadline)
+{
+  // Clamp to the period, so that one long frame (e.g. after loading a state) doesn't blow out the variance.
+  PhaseModel& phase = *m_current_phase;
+  const double sample = static_cast<double>(std::min(active_time, frame_period));
+  if (phase.num_samples == 0)
+  {
+    phase.mean = sample;
+    phase.variance = 0.0;
+  }
+  else
+  {
+    const double diff = sample - phase.mean;
+    phase.mean += SAMPLE_WEIGHT * diff;
+    phase.variance = (1.0 - SAMPLE_WEIGHT) * (phase.variance + SAMPLE_WEIGHT * diff * diff);
+  }
+  phase.num_samples++;
+  phase.last_used_frame = m_total_frames;
+
+  // Frames which take longer than the whole period would have missed regardless of how long we slept.
+  const bool sleep_caused_miss = (missed_deadline && active_time <= frame_period);
+  m_last_active_time = active_time;
+  m_last_frame_missed = sleep_caused_miss;
+  m_total_frames++;
+  m_total_misses += BoolToUInt32(sleep_caused_miss);
+  m_window_frames++;
+  m_window_misses += BoolToUInt32(sleep_caused_miss);
+  if (m_window_frames < MISS_RATE_WINDOW)
+    return;
+
+  const double allowed_misses = static_cast<double>(m_target_miss_rate) * static_cast<double>(m_window_frames);
+  const double misses = static_cast<double>(m_window_misses);
+  if (misses > allowed_misses)
+    m_margin = std::min(m_margin + MARGIN_INCREASE_STEP, MAX_MARGIN);
+  else if (misses < (allowed_misses * 0.5))
+    m_margin = std::max(m_margin - MARGIN_DECREASE_STEP, MIN_MARGIN);
+
+  DEBUG_LOG("{} misses in {} frames, margin now {:.2f} stddev", m_window_misses, m_window_frames, m_margin);
+  m_window_frames = 0;
+  m_window_misses = 0;
+}
+
+Common::Timer::Value FramePacer::GetPredictedActiveTime() const
+{
+  const PhaseModel& phase = *m_current_phase;
+  Common::Timer::Value predicted = static_cast<Common::Timer::Value>(phase.mean + m_margin * std::sqrt(phase.variance));
+
+  // Don't wait for the average to catch up after an overrun, the next frame is likely to be just as slow.
+  if (m_last_frame_missed)
+    predicted = std::max(predicted, m_last_active_time);
+
+  return predicted;
+}
+
+Common::Timer::Value FramePacer::GetSleepTime(Common::Timer::Value frame_period, Common::Timer::Value buffer) const
+{
+  if (m_current_phase->num_samples < WARMUP_SAMPLES)
+    return 0;
+
+  // Sleeps are only accurate to around a millisecond, so don't pretend otherwise.
+  const Common::Timer::Value expected_frame_time = GetPredictedActiveTime() + buffer;
+  return Common::AlignDown(frame_period - std::min(expected_frame_time, frame_period),
+                           static_cast<unsigned int>(Common::Timer::ConvertMillisecondsToValue(1)));
+}
+
+float FramePacer::GetMissRate() const
+{
+  return (m_total_frames > 0) ? (static_cast<float>(m_total_misses) / static_cast<float>(m_total_frames)) : 0.0f;
+}
@@ -0,0 +1,64 @@
+// SPDX-FileCopyrightText: 2019-2024 Connor McLaughlin <stenzek@gmail.com>
+// SPDX-License-Identifier: (GPL-3.0 OR CC-BY-NC-ND-4.0)
+
+#pragma once
+
+#include "types.h"
+
+#include "common/timer.h"
+
+#include <array>
+
+// Predicts how long the next frame will take to emulate, so the start of the frame can be delayed until just before
+// it has to be presented. The later the frame starts, the later input is polled, and the lower the input latency.
+class FramePacer
+{
+public:
+  static constexpr u32 MAX_PHASES = 8;
+
+  FramePacer();
+
+  /// Fraction of frames which may overrun their deadline because of the sleep, e.g. 0.01 for 1%.
+  void SetTargetMissRate(float rate) { m_target_miss_rate = rate; }
+
+  /// Discards all models.
+  void Reset();
+
+  /// Selects the model for the current game phase, such as the display mode. Unknown phases start from scratch.
+  void SetPhase(u32 key);
+
+  /// Feeds the time taken by the frame which just finished, and whether it made it in time for presentation.
+  void AddFrame(Common::Timer::Value active_time, Common::Timer::Value frame_period, bool missed_deadline);
+
+  /// Returns how long to wait before starting the next frame.
+  Common::Timer::Value GetSleepTime(Common::Timer::Value frame_period, Common::Timer::Value buffer) const;
+
+  /// Returns the expected active time of the next frame, including the safety margin.
+  Common::Timer::Value GetPredictedActiveTime() const;
+
+  /// Returns the fraction of frames which overran their deadline, since the last reset.
+  float GetMissRate() const;
+
+private:
+  struct PhaseModel
+  {
+    u32 key;
+    u32 num_samples;
+    u32 last_used_frame;
+    double mean;
+    double variance;
+  };
+
+  PhaseModel* m_current_phase = nullptr;
+  std::array<PhaseModel, MAX_PHASES> m_phases = {};
+
+  float m_target_miss_rate = 0.01f;
+  double m_margin;
+  Common::Timer::Value m_last_active_time = 0;
+  bool m_last_frame_missed = false;
+
+  u32 m_window_frames = 0;
+  u32 m_window_misses = 0;
+  u32 m_total_frames = 0;
+  u32 m_total_misses = 0;
+};
@@ -0,0 +1,241 @@
+// SPDX-FileCopyrightText: 2019-2024 Connor McLaughlin <stenzek@gmail.com>
+// SPDX-License-Identifier: (GPL-3.0 OR CC-BY-NC-ND-4.0)
+
+#include "frame_statistics.h"
+
+#include "util/gpu_device.h"
+
+#include "common/error.h"
+#include "common/file_system.h"
+#include "common/log.h"
+
+#include "fmt/format.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <span>
+#include <string>
+#include <utility>
+
+Log_SetChannel(FrameStatistics);
+
+namespace FrameStatistics {
+
+static const FrameRecord& GetRecord(u32 index);
+static float GetPercentile(std::span<float> values, float percentile);
+
+namespace {
+struct State
+{
+  std::array<FrameRecord, NUM_FRAME_RECORDS> records;
+  u32 record_pos = 0;
+  u32 record_count = 0;
+
+  std::array<Common::Timer::Value, NUM_PHASES> pending_phase_times = {};
+  std::array<Common::Timer::Value, NUM_STALL_CAUSES> pending_stall_times = {};
+
+  Summary summary = {};
+  std::array<float, NUM_FRAME_RECORDS> sort_scratch;
+};
+} // namespace
+
+static constexpr std::array<const char*, NUM_PHASES> s_phase_names = {
+  {"Emulation", "GPUSubmit", "Present", "Throttle", "PreFrameSleep"}};
+static constexpr std::array<const char*, NUM_STALL_CAUSES> s_stall_cause_names = {
+  {"None", "ShaderCompile", "CodeCacheReset", "DiscReadWait", "SaveStateIO"}};
+static constexpr std::array<const char*, NUM_STALL_CAUSES> s_stall_cause_display_names = {
+  {"Unattributed", "Shader Compile", "Code Cache Reset", "Disc Read", "Save State I/O"}};
+
+static State s_state;
+
+} // namespace FrameStatistics
+
+const char* FrameStatistics::GetPhaseName(Phase phase)
+{
+  return s_phase_names[static_cast<size_t>(phase)];
+}
+
+const char* FrameStatistics::GetStallCauseName(StallCause cause)
+{
+  return s_stall_cause_names[static_cast<size_t>(cause)];
+}
+
+const char* FrameStatistics::GetStallCauseDisplayName(StallCause cause)
+{
+  return s_stall_cause_display_names[static_cast<size_t>(cause)];
+}
+
+void FrameStatistics::Reset()
+{
+  s_state.record_pos = 0;
+  s_state.record_count = 0;
+  s_state.pending_phase_times = {};
+  s_state.pending_stall_times = {};
+  s_state.summary = {};
+}
+
+void FrameStatistics::AddPhaseTime(Phase phase, Common::Timer::Value time)
+{
+  s_state.pending_phase_times[static_cast<size_t>(phase)] += time;
+}
+
+void FrameStatistics::AddStallTime(StallCause cause, Common::Timer::Value time)
+{
+  s_state.pending_stall_times[static_cast<size_t>(cause)] += time;
+}
+
+void FrameStatistics::EndFrame(u32 frame_number, float frame_time, float frame_budget)
+{
+  // Shader compiles happen down in the device, which can't call back into core.
+  GPUDevice::Statistics& gpu_stats = GPUDevice::GetStatistics();
+  s_state.pending_stall_times[static_cast<size_t>(StallCause::ShaderCompile)] +=
+    std::exchange(gpu_stats.shader_compile_time, 0);
+
+  FrameRecord& rec = s_state.records[s_state.record_pos];
+  rec.frame_number = frame_number;
+  rec.frame_time = frame_time;
+  rec.frame_budget = frame_budget;
+  for (u32 i = 0; i < NUM_PHASES; i++)
+  {
+    rec.phase_times[i] =
+      static_cast<float>(Common::Timer::ConvertValueToMilliseconds(std::exchange(s_state.pending_phase_times[i], 0)));
+  }
+
+  u32 largest_stall = 0;
+  for (u32 i = 0; i < NUM_STALL_CAUSES; i++)
+  {
+    rec.stall_times[i] =
+      static_cast<float>(Common::Timer::ConvertValueToMilliseconds(std::exchange(s_state.pending_stall_times[i], 0)));
+    if (rec.stall_times[i] > rec.stall_times[largest_stall])
+      largest_stall = i;
+  }
+
+  rec.stall_cause = StallCause::None;
+  if (frame_time > frame_budget)
+  {
+    rec.stall_cause = static_cast<StallCause>(largest_stall);
+    s_state.summary.last_stall_cause = rec.stall_cause;
+    s_state.summary.last_stall_frame_time = frame_time;
+    if (rec.stall_cause != StallCause::None)
+    {
+      DEV_LOG("Frame {} took {:.2f} ms (budget {:.2f} ms), {:.2f} ms spent in {}", frame_number, frame_time,
+              frame_budget, rec.stall_times[largest_stall], GetStallCauseName(rec.stall_cause));
+    }
+  }
+
+  s_state.record_pos = (s_state.record_pos + 1) % NUM_FRAME_RECORDS;
+  s_state.record_count = std::min(s_state.record_count + 1, NUM_FRAME_RECORDS);
+}
+
+const FrameStatistics::FrameRecord& FrameStatistics::GetRecord(u32 index)
+{
+  // index 0 is the oldest frame
+  return s_state.records[(s_state.record_pos + NUM_FRAME_RECORDS - s_state.record_count + index) % NUM_FRAME_RECORDS];
+}
+
+float FrameStatistics::GetPercentile(std::span<float> values, float percentile)
+{
+  const size_t index =
+    std::min(static_cast<size_t>(std::ceil(percentile * static_cast<float>(values.size()))), values.size()) - 1;
+  std::nth_element(values.begin(), values.begin() + index, values.end());
+  return values[index];
+}
+
+void FrameStatistics::UpdateSummary()
+{
+  Summary& summary = s_state.summary;
+  summary.num_frames = s_state.record_count;
+  summary.num_over_budget_frames = 0;
+  summary.stall_cause_counts = {};
+  if (s_state.record_count == 0)
+  {
+    summary.p50_frame_time = summary.p95_frame_time = summary.p99_frame_time = summary.max_frame_time = 0.0f;
+    return;
+  }
+
+  for (u32 i = 0; i < s_state.record_count; i++)
+  {
+    const FrameRecord& rec = GetRecord(i);
+    s_state.sort_scratch[i] = rec.frame_time;
+    if (rec.frame_time > rec.frame_budget)
+    {
+      summary.num_over_budget_frames++;
+      summary.stall_cause_counts[static_cast<size_t>(rec.stall_cause)]++;
+    }
+  }
+
+  const std::span<float> values(s_state.sort_scratch.data(), s_state.record_count);
+  summary.p50_frame_time = GetPercentile(values, 0.50f);
+  summary.p95_frame_time = GetPercentile(values, 0.95f);
+  summary.p99_frame_time = GetPercentile(values, 0.99f);
+  summary.max_frame_time = *std::max_element(values.begin(), values.end());
+}
+
+const FrameStatistics::Summary& FrameStatistics::GetSummary()
+{
+  return s_state.summary;
+}
+
+bool FrameStatistics::ExportCSV(const char* path, Error* error)
+{
+  std::string csv;
+  csv.reserve(128 * (s_state.record_count + 1));
+  csv.append("Frame,FrameTime,Budget");
+  for (const char* name : s_phase_names)
+    fmt::format_to(std::back_inserter(csv), ",{}", name);
+  for (u32 i = 1; i < NUM_STALL_CAUSES; i++)
+    fmt::format_to(std::back_inserter(csv), ",{}", s_stall_cause_names[i]);
+  csv.append(",StallCause\n");
+
+  for (u32 i = 0; i < s_state.record_count; i++)
+  {
+    const FrameRecord& rec = GetRecord(i);
+    fmt::format_to(std::back_inserter(csv), "{},{:.3f},{:.3f}", rec.frame_number, rec.frame_time, rec.frame_budget);
+    for (const float time : rec.phase_times)
+      fmt::format_to(std::back_inserter(csv), ",{:.3f}", time);
+    for (u32 j = 1; j < NUM_STALL_CAUSES; j++)
+      fmt::format_to(std::back_inserter(csv), ",{:.3f}", rec.stall_times[j]);
+    fmt::format_to(std::back_inserter(csv), ",{}\n",
+                   (rec.frame_time > rec.frame_budget) ? GetStallCauseName(rec.stall_cause) : "");
+  }
+
+  return FileSystem::WriteStringToFile(path, csv, error);
+}
+
+bool FrameStatistics::ExportJSON(const char* path, Error* error)
+{
+  UpdateSummary();
+  const Summary& summary = s_state.summary;
+
+  std::string json;
+  json.reserve(256 * (s_state.record_count + 1));
+  fmt::format_to(std::back_inserter(json),
+                 "{{\n  \"summary\": {{\n    \"frames\": {},\n    \"p50\": {:.3f},\n    \"p95\": {:.3f},\n"
+                 "    \"p99\": {:.3f},\n    \"max\": {:.3f},\n    \"overBudget\": {},\n    \"stallCauses\": {{",
+                 summary.num_frames, summary.p50_frame_time, summary.p95_frame_time, summary.p99_frame_time,
+                 summary.max_frame_time, summary.num_over_budget_frames);
+  for (u32 i = 0; i < NUM_STALL_CAUSES; i++)
+  {
+    fmt::format_to(std::back_inserter(json), "{}\"{}\": {}", (i == 0) ? " " : ", ", s_stall_cause_names[i],
+                   summary.stall_cause_counts[i]);
+  }
+  json.append(" }\n  },\n  \"frames\": [");
+
+  for (u32 i = 0; i < s_state.record_count; i++)
+  {
+    const FrameRecord& rec = GetRecord(i);
+    fmt::format_to(std::back_inserter(json), "{}\n    {{ \"frame\": {}, \"time\": {:.3f}, \"budget\": {:.3f}",
+                   (i == 0) ? "" : ",", rec.frame_number, rec.frame_time, rec.frame_budget);
+    for (u32 j = 0; j < NUM_PHASES; j++)
+      fmt::format_to(std::back_inserter(json), ", \"{}\": {:.3f}", s_phase_names[j], rec.phase_times[j]);
+    for (u32 j = 1; j < NUM_STALL_CAUSES; j++)
+      fmt::format_to(std::back_inserter(json), ", \"{}\": {:.3f}", s_stall_cause_names[j], rec.stall_times[j]);
+    if (rec.frame_time > rec.frame_budget)
+      fmt::format_to(std::back_inserter(json), ", \"stallCause\": \"{}\"", GetStallCauseName(rec.stall_cause));
+    json.append(" }");
+  }
+  json.append("\n  ]\n}\n");
+
+  return FileSystem::WriteStringToFile(path, json, error);
+}
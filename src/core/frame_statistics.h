@@ -0,0 +1,106 @@
+// SPDX-FileCopyrightText: 2019-2024 Connor McLaughlin <stenzek@gmail.com>
+// SPDX-License-Identifier: (GPL-3.0 OR CC-BY-NC-ND-4.0)
+
+#pragma once
+
+#include "types.h"
+
+#include "common/timer.h"
+
+#include <array>
+
+class Error;
+
+//////////////////////////////////////////////////////////////////////////
+// Per-frame timing breakdown, percentiles, and over-budget attribution.
+// All functions must be called on the CPU thread.
+//////////////////////////////////////////////////////////////////////////
+
+namespace FrameStatistics {
+
+enum class Phase : u8
+{
+  Emulation,
+  GPUSubmit,
+  Present,
+  Throttle,
+  PreFrameSleep,
+  MaxCount
+};
+
+enum class StallCause : u8
+{
+  None,
+  ShaderCompile,
+  CodeCacheReset,
+  DiscReadWait,
+  SaveStateIO,
+  MaxCount
+};
+
+static constexpr u32 NUM_FRAME_RECORDS = 1024;
+static constexpr u32 NUM_PHASES = static_cast<u32>(Phase::MaxCount);
+static constexpr u32 NUM_STALL_CAUSES = static_cast<u32>(StallCause::MaxCount);
+
+struct FrameRecord
+{
+  u32 frame_number;
+  float frame_time;
+  float frame_budget;
+  std::array<float, NUM_PHASES> phase_times;
+  std::array<float, NUM_STALL_CAUSES> stall_times;
+  StallCause stall_cause; // only set when over budget
+};
+
+struct Summary
+{
+  float p50_frame_time;
+  float p95_frame_time;
+  float p99_frame_time;
+  float max_frame_time;
+  u32 num_frames;
+  u32 num_over_budget_frames;
+  std::array<u32, NUM_STALL_CAUSES> stall_cause_counts;
+  StallCause last_stall_cause;
+  float last_stall_frame_time;
+};
+
+const char* GetPhaseName(Phase phase);
+const char* GetStallCauseName(StallCause cause);
+const char* GetStallCauseDisplayName(StallCause cause);
+
+/// Clears the history, called when a new system is booted.
+void Reset();
+
+/// Accumulates time into the current frame.
+void AddPhaseTime(Phase phase, Common::Timer::Value time);
+void AddStallTime(StallCause cause, Common::Timer::Value time);
+
+/// Closes out the current frame. Frames longer than the budget are attributed to the largest stall.
+void EndFrame(u32 frame_number, float frame_time, float frame_budget);
+
+/// Recomputes the percentiles over the history, called at the performance counter update interval.
+void UpdateSummary();
+const Summary& GetSummary();
+
+bool ExportCSV(const char* path, Error* error);
+bool ExportJSON(const char* path, Error* error);
+
+/// Records the lifetime of the object as a stall.
+class ScopedStall
+{
+public:
+  ALWAYS_INLINE explicit ScopedStall(StallCause cause) : m_start_time(Common::Timer::GetCurrentValue()), m_cause(cause)
+  {
+  }
+  ALWAYS_INLINE ~ScopedStall() { AddStallTime(m_cause, Common::Timer::GetCurrentValue() - m_start_time); }
+
+  ScopedStall(const ScopedStall&) = delete;
+  ScopedStall& operator=(const ScopedStall&) = delete;
+
+private:
+  Common::Timer::Value m_start_time;
+  StallCause m_cause;
+};
+
+} // namespace FrameStatistics
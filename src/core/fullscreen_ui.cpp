@@ -464,7 +464,9 @@ static void DrawGameListSettingsWindow();
 static void SwitchToGameList();
 static void PopulateGameListEntryList();
 static GPUTexture* GetTextureForGameListEntryType(GameList::EntryType type);
+static const std::string& GetGameListCoverPath(const GameList::Entry* entry);
 static GPUTexture* GetGameListCover(const GameList::Entry* entry);
+static ImGuiFullscreen::ThumbnailInfo GetGameListCoverThumbnail(const GameList::Entry* entry);
 static GPUTexture* GetCoverForCurrentGame();
 
 // Lazily populated cover images.
@@ -573,7 +575,8 @@ bool FullscreenUI::Initialize()
   ImGuiFullscreen::SetTheme(Host::GetBaseBoolSettingValue("Main", "UseLightFullscreenUITheme", false));
   ImGuiFullscreen::UpdateLayoutScale();
 
-  if (!ImGuiManager::AddFullscreenFontsIfMissing() || !ImGuiFullscreen::Initialize("images/placeholder.png") ||
+  if (!ImGuiManager::AddFullscreenFontsIfMissing() ||
+      !ImGuiFullscreen::Initialize("images/placeholder.png", Path::Combine(EmuFolders::Cache, "thumbnails.cache")) ||
       !LoadResources())
   {
     DestroyResources();
@@ -3464,6 +3467,17 @@ void FullscreenUI::DrawEmulationSettingsPage()
     FSUI_CSTR("Specifies the amount of buffer time added, which reduces the additional sleep time introduced."),
     "Display", "PreFrameSleepBuffer", Settings::DEFAULT_DISPLAY_PRE_FRAME_SLEEP_BUFFER, 0.0f, 20.0f, "%.1f", 1.0f,
     pre_frame_sleep_active);
+  DrawFloatRangeSetting(
+    bsi, FSUI_ICONSTR(ICON_FA_BULLSEYE, "Target Miss Rate"),
+    FSUI_CSTR("Percentage of frames allowed to be late because of the delay. Lower values increase input latency."),
+    "Display", "PreFrameSleepMissRate", Settings::DEFAULT_DISPLAY_PRE_FRAME_SLEEP_MISS_RATE, 0.1f, 50.0f, "%.1f%%",
+    1.0f, pre_frame_sleep_active);
+  const bool runahead_active = (GetEffectiveIntSetting(bsi, "Main", "RunaheadFrameCount", 0) > 0);
+  DrawIntRangeSetting(
+    bsi, FSUI_ICONSTR(ICON_FA_GAMEPAD, "Sub-Frame Input Polling Rate"),
+    FSUI_CSTR("Polls controllers again when the game reads them, at most this many times per second. 0 polls once "
+              "per frame. Not used with runahead."),
+    "Main", "InputPollingRate", 0, 0, 8000, FSUI_CSTR("%d Hz"), !runahead_active);
 
   MenuHeading(FSUI_CSTR("Runahead/Rewind"));
 
@@ -5192,6 +5206,21 @@ void FullscreenUI::DrawAdvancedSettingsPage()
                   "SaveStateCompression", Settings::DEFAULT_SAVE_STATE_COMPRESSION_MODE,
                   &Settings::ParseSaveStateCompressionModeName, &Settings::GetSaveStateCompressionModeName,
                   &Settings::GetSaveStateCompressionModeDisplayName, SaveStateCompressionMode::Count);
+  DrawEnumSetting(
+    bsi, FSUI_CSTR("Thread Placement"),
+    FSUI_CSTR("Keeps the emulation thread on the performance cores, or pins it to one core away from other threads."),
+    "Main", "ThreadPlacement", Settings::DEFAULT_THREAD_PLACEMENT_MODE, &Settings::ParseThreadPlacementModeName,
+    &Settings::GetThreadPlacementModeName, &Settings::GetThreadPlacementModeDisplayName, ThreadPlacementMode::Count);
+  const ThreadPlacementMode thread_placement =
+    Settings::ParseThreadPlacementModeName(
+      GetEffectiveTinyStringSetting(bsi, "Main", "ThreadPlacement",
+                                    Settings::GetThreadPlacementModeName(Settings::DEFAULT_THREAD_PLACEMENT_MODE))
+        .c_str())
+      .value_or(Settings::DEFAULT_THREAD_PLACEMENT_MODE);
+  DrawIntRangeSetting(bsi, FSUI_CSTR("CPU Thread Processor"),
+                      FSUI_CSTR("Processor to pin the emulation thread to in pinned mode, -1 chooses automatically."),
+                      "Main", "CPUThreadProcessor", -1, -1, 63, "%d",
+                      (thread_placement == ThreadPlacementMode::Pinned));
 
   MenuHeading(FSUI_CSTR("Display Settings"));
   DrawToggleSetting(bsi, FSUI_CSTR("Show Status Indicators"),
@@ -6330,7 +6359,7 @@ void FullscreenUI::DrawGameList(const ImVec2& heading_size)
       if (!visible)
         continue;
 
-      GPUTexture* cover_texture = GetGameListCover(entry);
+      const ImGuiFullscreen::ThumbnailInfo cover = GetGameListCoverThumbnail(entry);
 
       if (entry->serial.empty())
         summary.format("{} - ", Settings::GetDiscRegionDisplayName(entry->region));
@@ -6339,12 +6368,10 @@ void FullscreenUI::DrawGameList(const ImVec2& heading_size)
 
       summary.append(Path::GetFileName(entry->path));
 
-      const ImRect image_rect(
-        CenterImage(ImRect(bb.Min, bb.Min + image_size), ImVec2(static_cast<float>(cover_texture->GetWidth()),
-                                                                static_cast<float>(cover_texture->GetHeight()))));
+      const ImRect image_rect(CenterImage(ImRect(bb.Min, bb.Min + image_size), cover.size));
 
-      ImGui::GetWindowDrawList()->AddImage(cover_texture, image_rect.Min, image_rect.Max, ImVec2(0.0f, 0.0f),
-                                           ImVec2(1.0f, 1.0f), IM_COL32(255, 255, 255, 255));
+      ImGui::GetWindowDrawList()->AddImage(cover.texture, image_rect.Min, image_rect.Max, cover.uv0, cover.uv1,
+                                           IM_COL32(255, 255, 255, 255));
 
       const float midpoint = bb.Min.y + g_large_font->FontSize + LayoutScale(4.0f);
       const float text_start_x = bb.Min.x + image_size.x + LayoutScale(15.0f);
@@ -6575,13 +6602,11 @@ void FullscreenUI::DrawGameGrid(const ImVec2& heading_size)
       bb.Min += style.FramePadding;
       bb.Max -= style.FramePadding;
 
-      GPUTexture* const cover_texture = GetGameListCover(entry);
-      const ImRect image_rect(
-        CenterImage(ImRect(bb.Min, bb.Min + image_size), ImVec2(static_cast<float>(cover_texture->GetWidth()),
-                                                                static_cast<float>(cover_texture->GetHeight()))));
+      const ImGuiFullscreen::ThumbnailInfo cover = GetGameListCoverThumbnail(entry);
+      const ImRect image_rect(CenterImage(ImRect(bb.Min, bb.Min + image_size), cover.size));
 
-      ImGui::GetWindowDrawList()->AddImage(cover_texture, image_rect.Min, image_rect.Max, ImVec2(0.0f, 0.0f),
-                                           ImVec2(1.0f, 1.0f), IM_COL32(255, 255, 255, 255));
+      ImGui::GetWindowDrawList()->AddImage(cover.texture, image_rect.Min, image_rect.Max, cover.uv0, cover.uv1,
+                                           IM_COL32(255, 255, 255, 255));
 
       const ImRect title_bb(ImVec2(bb.Min.x, bb.Min.y + image_height + title_spacing), bb.Max);
       const std::string_view title(
@@ -6947,9 +6972,8 @@ void FullscreenUI::SwitchToGameList()
   QueueResetFocus(FocusResetType::ViewChanged);
 }
 
-GPUTexture* FullscreenUI::GetGameListCover(const GameList::Entry* entry)
+const std::string& FullscreenUI::GetGameListCoverPath(const GameList::Entry* entry)
 {
-  // lookup and grab cover image
   auto cover_it = s_cover_image_map.find(entry->path);
   if (cover_it == s_cover_image_map.end())
   {
@@ -6957,10 +6981,29 @@ GPUTexture* FullscreenUI::GetGameListCover(const GameList::Entry* entry)
     cover_it = s_cover_image_map.emplace(entry->path, std::move(cover_path)).first;
   }
 
-  GPUTexture* tex = (!cover_it->second.empty()) ? GetCachedTextureAsync(cover_it->second.c_str()) : nullptr;
+  return cover_it->second;
+}
+
+GPUTexture* FullscreenUI::GetGameListCover(const GameList::Entry* entry)
+{
+  // lookup and grab cover image
+  const std::string& cover_path = GetGameListCoverPath(entry);
+  GPUTexture* tex = (!cover_path.empty()) ? GetCachedTextureAsync(cover_path.c_str()) : nullptr;
   return tex ? tex : GetTextureForGameListEntryType(entry->type);
 }
 
+ImGuiFullscreen::ThumbnailInfo FullscreenUI::GetGameListCoverThumbnail(const GameList::Entry* entry)
+{
+  // Only the list and grid use thumbnails, the selected game's details show the full-size cover.
+  const std::string& cover_path = GetGameListCoverPath(entry);
+  if (!cover_path.empty())
+    return ImGuiFullscreen::GetCachedThumbnailAsync(cover_path);
+
+  GPUTexture* const tex = GetTextureForGameListEntryType(entry->type);
+  const ImVec2 size(static_cast<float>(tex->GetWidth()), static_cast<float>(tex->GetHeight()));
+  return ImGuiFullscreen::ThumbnailInfo{tex, ImVec2(0.0f, 0.0f), ImVec2(1.0f, 1.0f), size};
+}
+
 GPUTexture* FullscreenUI::GetTextureForGameListEntryType(GameList::EntryType type)
 {
   switch (type)
@@ -7154,6 +7197,7 @@ bool FullscreenUI::IsLeaderboardsWindowOpen()
 // TRANSLATION-STRING-AREA-BEGIN
 TRANSLATE_NOOP("FullscreenUI", "%.2f Seconds");
 TRANSLATE_NOOP("FullscreenUI", "%d Frames");
+TRANSLATE_NOOP("FullscreenUI", "%d Hz");
 TRANSLATE_NOOP("FullscreenUI", "%d ms");
 TRANSLATE_NOOP("FullscreenUI", "%d sectors");
 TRANSLATE_NOOP("FullscreenUI", "-");
@@ -7276,6 +7320,7 @@ TRANSLATE_NOOP("FullscreenUI", "Buffer Size");
 TRANSLATE_NOOP("FullscreenUI", "CD-ROM Emulation");
 TRANSLATE_NOOP("FullscreenUI", "CPU Emulation");
 TRANSLATE_NOOP("FullscreenUI", "CPU Mode");
+TRANSLATE_NOOP("FullscreenUI", "CPU Thread Processor");
 TRANSLATE_NOOP("FullscreenUI", "Cancel");
 TRANSLATE_NOOP("FullscreenUI", "Capture");
 TRANSLATE_NOOP("FullscreenUI", "Change Disc");
@@ -7488,6 +7533,7 @@ TRANSLATE_NOOP("FullscreenUI", "Input profile '{}' saved.");
 TRANSLATE_NOOP("FullscreenUI", "Integration");
 TRANSLATE_NOOP("FullscreenUI", "Interface Settings");
 TRANSLATE_NOOP("FullscreenUI", "Internal Resolution");
+TRANSLATE_NOOP("FullscreenUI", "Keeps the emulation thread on the performance cores, or pins it to one core away from other threads.");
 TRANSLATE_NOOP("FullscreenUI", "Last Played");
 TRANSLATE_NOOP("FullscreenUI", "Last Played: %s");
 TRANSLATE_NOOP("FullscreenUI", "Latency Control");
@@ -7583,10 +7629,12 @@ TRANSLATE_NOOP("FullscreenUI", "Pauses the emulator when a game is started.");
 TRANSLATE_NOOP("FullscreenUI", "Pauses the emulator when you minimize the window or switch to another application, and unpauses when you switch back.");
 TRANSLATE_NOOP("FullscreenUI", "Per-Game Configuration");
 TRANSLATE_NOOP("FullscreenUI", "Per-game controller configuration initialized with global settings.");
+TRANSLATE_NOOP("FullscreenUI", "Percentage of frames allowed to be late because of the delay. Lower values increase input latency.");
 TRANSLATE_NOOP("FullscreenUI", "Performance enhancement - jumps directly between blocks instead of returning to the dispatcher.");
 TRANSLATE_NOOP("FullscreenUI", "Perspective Correct Colors");
 TRANSLATE_NOOP("FullscreenUI", "Perspective Correct Textures");
 TRANSLATE_NOOP("FullscreenUI", "Plays sound effects for events such as achievement unlocks and leaderboard submissions.");
+TRANSLATE_NOOP("FullscreenUI", "Polls controllers again when the game reads them, at most this many times per second. 0 polls once per frame. Not used with runahead.");
 TRANSLATE_NOOP("FullscreenUI", "Port {} Controller Type");
 TRANSLATE_NOOP("FullscreenUI", "Post-Processing Settings");
 TRANSLATE_NOOP("FullscreenUI", "Post-processing chain cleared.");
@@ -7597,6 +7645,7 @@ TRANSLATE_NOOP("FullscreenUI", "Presents frames on a background thread when fast
 TRANSLATE_NOOP("FullscreenUI", "Preserve Projection Precision");
 TRANSLATE_NOOP("FullscreenUI", "Prevents the emulator from producing any audible sound.");
 TRANSLATE_NOOP("FullscreenUI", "Prevents the screen saver from activating and the host from sleeping while emulation is running.");
+TRANSLATE_NOOP("FullscreenUI", "Processor to pin the emulation thread to in pinned mode, -1 chooses automatically.");
 TRANSLATE_NOOP("FullscreenUI", "Provides vibration and LED control support over Bluetooth.");
 TRANSLATE_NOOP("FullscreenUI", "Push a controller button or axis now.");
 TRANSLATE_NOOP("FullscreenUI", "Quick Save");
@@ -7756,11 +7805,13 @@ TRANSLATE_NOOP("FullscreenUI", "Stores the current settings to an input profile.
 TRANSLATE_NOOP("FullscreenUI", "Stretch Display Vertically");
 TRANSLATE_NOOP("FullscreenUI", "Stretch Mode");
 TRANSLATE_NOOP("FullscreenUI", "Stretches the display to match the aspect ratio by multiplying vertically instead of horizontally.");
+TRANSLATE_NOOP("FullscreenUI", "Sub-Frame Input Polling Rate");
 TRANSLATE_NOOP("FullscreenUI", "Summary");
 TRANSLATE_NOOP("FullscreenUI", "Switches back to 4:3 display aspect ratio when displaying 24-bit content, usually FMVs.");
 TRANSLATE_NOOP("FullscreenUI", "Switches between full screen and windowed when the window is double-clicked.");
 TRANSLATE_NOOP("FullscreenUI", "Sync To Host Refresh Rate");
 TRANSLATE_NOOP("FullscreenUI", "Synchronizes presentation of the console's frames to the host. GSync/FreeSync users should enable Optimal Frame Pacing instead.");
+TRANSLATE_NOOP("FullscreenUI", "Target Miss Rate");
 TRANSLATE_NOOP("FullscreenUI", "Temporarily disables all enhancements, useful when testing.");
 TRANSLATE_NOOP("FullscreenUI", "Test Unofficial Achievements");
 TRANSLATE_NOOP("FullscreenUI", "Texture Filtering");
@@ -7771,6 +7822,7 @@ TRANSLATE_NOOP("FullscreenUI", "The audio backend determines how frames produced
 TRANSLATE_NOOP("FullscreenUI", "The selected memory card image will be used in shared mode for this slot.");
 TRANSLATE_NOOP("FullscreenUI", "This game has no achievements.");
 TRANSLATE_NOOP("FullscreenUI", "This game has no leaderboards.");
+TRANSLATE_NOOP("FullscreenUI", "Thread Placement");
 TRANSLATE_NOOP("FullscreenUI", "Threaded Presentation");
 TRANSLATE_NOOP("FullscreenUI", "Threaded Rendering");
 TRANSLATE_NOOP("FullscreenUI", "Time Played");
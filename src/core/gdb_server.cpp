@@ -14,25 +14,26 @@
 
 #include "util/sockets.h"
 
-#include <functional>
-#include <iomanip>
-#include <map>
+#include <array>
 #include <optional>
 #include <sstream>
 #include <string>
+#include <unordered_map>
 
 Log_SetChannel(GDBProtocol);
 
 namespace GDBProtocol {
-static bool IsPacketInterrupt(std::string_view data);
-static bool IsPacketContinue(std::string_view data);
-
-static bool IsPacketComplete(std::string_view data);
 static std::string ProcessPacket(std::string_view data);
 } // namespace GDBProtocol
 
 namespace GDBProtocol {
 
+/// Largest packet we accept, reported to the client in qSupported.
+static constexpr u32 MAX_PACKET_SIZE = 0x20000;
+
+/// Set once the client has asked us to stop acknowledging packets.
+static bool s_no_ack_mode = false;
+
 static u8* GetMemoryPointer(PhysicalMemoryAddress address, u32 length)
 {
   auto region = Bus::GetMemoryRegionForAddress(address);
@@ -81,9 +82,107 @@ static std::optional<std::string_view> DeserializePacket(std::string_view in)
 
 static std::string SerializePacket(std::string_view in)
 {
-  std::stringstream ss;
-  ss << '$' << in << '#' << TinyString::from_format("{:02x}", ComputeChecksum(in));
-  return ss.str();
+  std::string ret;
+  ret.reserve(in.size() + 4);
+  ret.push_back('$');
+  ret.append(in);
+  fmt::format_to(std::back_inserter(ret), "#{:02x}", ComputeChecksum(in));
+  return ret;
+}
+
+/// Parses "addr,length", optionally followed by ":payload".
+static bool ParseAddressAndLength(std::string_view data, VirtualMemoryAddress* address, u32* length,
+                                  std::string_view* payload = nullptr)
+{
+  const std::string_view::size_type comma = data.find(',');
+  if (comma == std::string_view::npos)
+    return false;
+
+  const std::string_view::size_type colon = data.find(':', comma);
+  const std::optional<VirtualMemoryAddress> parsed_address =
+    StringUtil::FromChars<VirtualMemoryAddress>(data.substr(0, comma), 16);
+  const std::optional<u32> parsed_length = StringUtil::FromChars<u32>(
+    data.substr(comma + 1, (colon != std::string_view::npos) ? (colon - comma - 1) : std::string_view::npos), 16);
+  if (!parsed_address.has_value() || !parsed_length.has_value())
+    return false;
+
+  *address = parsed_address.value();
+  *length = parsed_length.value();
+  if (payload)
+    *payload = (colon != std::string_view::npos) ? data.substr(colon + 1) : std::string_view();
+
+  return true;
+}
+
+/// Appends binary data, escaping the characters which are special in the protocol.
+static void AppendEscapedBinary(std::string& out, const u8* data, size_t length)
+{
+  out.reserve(out.size() + length);
+  for (size_t i = 0; i < length; i++)
+  {
+    const u8 value = data[i];
+    if (value == '#' || value == '$' || value == '}' || value == '*')
+    {
+      out.push_back('}');
+      out.push_back(static_cast<char>(value ^ 0x20));
+    }
+    else
+    {
+      out.push_back(static_cast<char>(value));
+    }
+  }
+}
+
+/// Decodes escaped binary data, returns false if it doesn't decode to exactly the expected length.
+static bool DecodeEscapedBinary(std::string_view in, std::vector<u8>* out, u32 expected_length)
+{
+  out->clear();
+  out->reserve(expected_length);
+  for (size_t i = 0; i < in.size(); i++)
+  {
+    u8 value = static_cast<u8>(in[i]);
+    if (value == '}')
+    {
+      if (++i == in.size())
+        return false;
+
+      value = static_cast<u8>(in[i]) ^ 0x20;
+    }
+
+    out->push_back(value);
+  }
+
+  return (out->size() == expected_length);
+}
+
+/// Memory regions accessible through the KUSEG/KSEG0/KSEG1 mirrors.
+static std::string GetMemoryMapXML()
+{
+  static constexpr std::array<VirtualMemoryAddress, 3> segments = {0x00000000u, 0x80000000u, 0xA0000000u};
+
+  std::string ret = "<?xml version=\"1.0\"?>\n"
+                    "<!DOCTYPE memory-map PUBLIC \"+//IDN gnu.org//DTD GDB Memory Map V1.0//EN\" "
+                    "\"http://sourceware.org/gdb/gdb-memory-map.dtd\">\n"
+                    "<memory-map>\n";
+  for (const VirtualMemoryAddress segment : segments)
+  {
+    fmt::format_to(std::back_inserter(ret), "  <memory type=\"ram\" start=\"0x{:08x}\" length=\"0x{:x}\"/>\n", segment,
+                   static_cast<u32>(Bus::RAM_MIRROR_END));
+    fmt::format_to(std::back_inserter(ret), "  <memory type=\"ram\" start=\"0x{:08x}\" length=\"0x{:x}\"/>\n",
+                   segment | Bus::EXP1_BASE, static_cast<u32>(Bus::EXP1_SIZE));
+
+    // scratchpad isn't accessible through the uncached segment
+    if (segment != 0xA0000000u)
+    {
+      fmt::format_to(std::back_inserter(ret), "  <memory type=\"ram\" start=\"0x{:08x}\" length=\"0x{:x}\"/>\n",
+                     segment | CPU::SCRATCHPAD_ADDR, static_cast<u32>(CPU::SCRATCHPAD_SIZE));
+    }
+
+    fmt::format_to(std::back_inserter(ret), "  <memory type=\"rom\" start=\"0x{:08x}\" length=\"0x{:x}\"/>\n",
+                   segment | Bus::BIOS_BASE, static_cast<u32>(Bus::BIOS_SIZE));
+  }
+  ret.append("</memory-map>\n");
+  return ret;
 }
 
 /// List of GDB remote protocol registers for MIPS III (excluding FP).
@@ -187,24 +286,36 @@ static std::optional<std::string> Cmd$G(std::string_view data)
 /// Get memory.
 static std::optional<std::string> Cmd$m(std::string_view data)
 {
-  std::stringstream ss{std::string{data}};
-  std::string dataAddress, dataLength;
-
-  std::getline(ss, dataAddress, ',');
-  std::getline(ss, dataLength, '\0');
+  VirtualMemoryAddress address;
+  u32 length;
+  if (ParseAddressAndLength(data, &address, &length))
+  {
+    PhysicalMemoryAddress phys_addr = address & CPU::PHYSICAL_MEMORY_ADDRESS_MASK;
 
-  auto address = StringUtil::FromChars<VirtualMemoryAddress>(dataAddress, 16);
-  auto length = StringUtil::FromChars<u32>(dataLength, 16);
+    u8* ptr_data = GetMemoryPointer(phys_addr, length);
+    if (ptr_data)
+    {
+      return {StringUtil::EncodeHex(ptr_data, length)};
+    }
+  }
+  return {"E00"};
+}
 
-  if (address && length)
+/// Get memory, binary reply.
+static std::optional<std::string> Cmd$x(std::string_view data)
+{
+  VirtualMemoryAddress address;
+  u32 length;
+  if (ParseAddressAndLength(data, &address, &length))
   {
-    PhysicalMemoryAddress phys_addr = *address & CPU::PHYSICAL_MEMORY_ADDRESS_MASK;
-    u32 phys_length = *length;
+    PhysicalMemoryAddress phys_addr = address & CPU::PHYSICAL_MEMORY_ADDRESS_MASK;
 
-    u8* ptr_data = GetMemoryPointer(phys_addr, phys_length);
+    const u8* ptr_data = GetMemoryPointer(phys_addr, length);
     if (ptr_data)
     {
-      return {StringUtil::EncodeHex(ptr_data, phys_length)};
+      std::string reply = "b";
+      AppendEscapedBinary(reply, ptr_data, length);
+      return reply;
     }
   }
   return {"E00"};
@@ -213,21 +324,17 @@ static std::optional<std::string> Cmd$m(std::string_view data)
 /// Set memory.
 static std::optional<std::string> Cmd$M(std::string_view data)
 {
-  std::stringstream ss{std::string{data}};
-  std::string dataAddress, dataLength, dataPayload;
-
-  std::getline(ss, dataAddress, ',');
-  std::getline(ss, dataLength, ':');
-  std::getline(ss, dataPayload, '\0');
-
-  auto address = StringUtil::FromChars<VirtualMemoryAddress>(dataAddress, 16);
-  auto length = StringUtil::FromChars<u32>(dataLength, 16);
-  auto payload = StringUtil::DecodeHex(dataPayload);
-
-  if (address && length && payload && (payload->size() == *length))
+  VirtualMemoryAddress address;
+  u32 length;
+  std::string_view hex_payload;
+  if (!ParseAddressAndLength(data, &address, &length, &hex_payload))
+    return {"E00"};
+
+  auto payload = StringUtil::DecodeHex(hex_payload);
+  if (payload && (payload->size() == length))
   {
-    u32 phys_addr = *address & CPU::PHYSICAL_MEMORY_ADDRESS_MASK;
-    u32 phys_length = *length;
+    u32 phys_addr = address & CPU::PHYSICAL_MEMORY_ADDRESS_MASK;
+    u32 phys_length = length;
 
     u8* ptr_data = GetMemoryPointer(phys_addr, phys_length);
     if (ptr_data)
@@ -240,6 +347,30 @@ static std::optional<std::string> Cmd$M(std::string_view data)
   return {"E00"};
 }
 
+/// Set memory, binary payload.
+static std::optional<std::string> Cmd$X(std::string_view data)
+{
+  VirtualMemoryAddress address;
+  u32 length;
+  std::string_view payload;
+  if (ParseAddressAndLength(data, &address, &length, &payload))
+  {
+    // zero-length writes are used to probe for support
+    if (length == 0)
+      return {"OK"};
+
+    std::vector<u8> decoded;
+    u8* ptr_data = GetMemoryPointer(address & CPU::PHYSICAL_MEMORY_ADDRESS_MASK, length);
+    if (ptr_data && DecodeEscapedBinary(payload, &decoded, length))
+    {
+      std::memcpy(ptr_data, decoded.data(), length);
+      return {"OK"};
+    }
+  }
+
+  return {"E00"};
+}
+
 /// Remove hardware breakpoint.
 static std::optional<std::string> Cmd$z1(std::string_view data)
 {
@@ -270,6 +401,24 @@ static std::optional<std::string> Cmd$Z1(std::string_view data)
   }
 }
 
+/// Remove breakpoint, software and hardware are both treated as hardware.
+static std::optional<std::string> Cmd$z(std::string_view data)
+{
+  if (data.starts_with("0,") || data.starts_with("1,"))
+    return Cmd$z1(data.substr(2));
+  else
+    return {""};
+}
+
+/// Insert breakpoint, software and hardware are both treated as hardware.
+static std::optional<std::string> Cmd$Z(std::string_view data)
+{
+  if (data.starts_with("0,") || data.starts_with("1,"))
+    return Cmd$Z1(data.substr(2));
+  else
+    return {""};
+}
+
 static std::optional<std::string> Cmd$vMustReplyEmpty(std::string_view data)
 {
   return {""};
@@ -277,37 +426,84 @@ static std::optional<std::string> Cmd$vMustReplyEmpty(std::string_view data)
 
 static std::optional<std::string> Cmd$qSupported(std::string_view data)
 {
-  return {""};
+  return fmt::format("PacketSize={:x};qXfer:memory-map:read+;QStartNoAckMode+;binary-upload+", MAX_PACKET_SIZE);
 }
 
-/// List of all GDB remote protocol packets supported by us.
-static const std::map<const char*, std::function<std::optional<std::string>(std::string_view)>> COMMANDS{
-  {"?", Cmd$_questionMark},
-  {"g", Cmd$g},
-  {"G", Cmd$G},
-  {"m", Cmd$m},
-  {"M", Cmd$M},
-  {"z0,", Cmd$z1},
-  {"Z0,", Cmd$Z1},
-  {"z1,", Cmd$z1},
-  {"Z1,", Cmd$Z1},
-  {"vMustReplyEmpty", Cmd$vMustReplyEmpty},
-  {"qSupported", Cmd$qSupported},
-};
-
-bool IsPacketInterrupt(std::string_view data)
+/// Read target objects, only the memory map is supported.
+static std::optional<std::string> Cmd$qXfer(std::string_view data)
 {
-  return (data.size() >= 1) && (data[data.size() - 1] == '\003');
+  static constexpr std::string_view memory_map_prefix = ":memory-map:read::";
+  if (!data.starts_with(memory_map_prefix))
+    return {""};
+
+  u32 offset, length;
+  if (!ParseAddressAndLength(data.substr(memory_map_prefix.size()), &offset, &length))
+    return {"E00"};
+
+  static const std::string memory_map = GetMemoryMapXML();
+  if (offset >= memory_map.size())
+    return {"l"};
+
+  const size_t chunk_length = std::min<size_t>(length, memory_map.size() - offset);
+  std::string reply((offset + chunk_length) == memory_map.size() ? "l" : "m");
+  AppendEscapedBinary(reply, reinterpret_cast<const u8*>(memory_map.data()) + offset, chunk_length);
+  return reply;
 }
 
-bool IsPacketContinue(std::string_view data)
+static std::optional<std::string> Cmd$QStartNoAckMode(std::string_view data)
 {
-  return (data.size() >= 5) && (data.substr(data.size() - 5) == "$c#63");
+  s_no_ack_mode = true;
+  return {"OK"};
 }
 
-bool IsPacketComplete(std::string_view data)
+using CommandHandler = std::optional<std::string> (*)(std::string_view);
+
+/// Single-letter packets, indexed by the packet's first character.
+static constexpr std::array<CommandHandler, 128> LETTER_COMMANDS = []() {
+  std::array<CommandHandler, 128> ret = {};
+  ret['?'] = Cmd$_questionMark;
+  ret['g'] = Cmd$g;
+  ret['G'] = Cmd$G;
+  ret['m'] = Cmd$m;
+  ret['M'] = Cmd$M;
+  ret['x'] = Cmd$x;
+  ret['X'] = Cmd$X;
+  ret['z'] = Cmd$z;
+  ret['Z'] = Cmd$Z;
+  return ret;
+}();
+
+/// Named 'q', 'Q' and 'v' packets, keyed by the name up to the first separator.
+static const std::unordered_map<std::string_view, CommandHandler> NAMED_COMMANDS{
+  {"vMustReplyEmpty", Cmd$vMustReplyEmpty},
+  {"qSupported", Cmd$qSupported},
+  {"qXfer", Cmd$qXfer},
+  {"QStartNoAckMode", Cmd$QStartNoAckMode},
+};
+
+/// Finds the handler for a packet, and the payload to pass to it.
+static CommandHandler LookupCommand(std::string_view packet, std::string_view* payload)
 {
-  return ((data.size() == 1) && (data[0] == '\003')) || ((data.size() > 3) && (*(data.end() - 3) == '#'));
+  if (packet.empty())
+    return nullptr;
+
+  const char first = packet[0];
+  if (first == 'q' || first == 'Q' || first == 'v')
+  {
+    const std::string_view name = packet.substr(0, packet.find_first_of(":,;?"));
+    const auto iter = NAMED_COMMANDS.find(name);
+    if (iter == NAMED_COMMANDS.end())
+      return nullptr;
+
+    *payload = packet.substr(name.size());
+    return iter->second;
+  }
+
+  if (static_cast<u8>(first) >= LETTER_COMMANDS.size())
+    return nullptr;
+
+  *payload = packet.substr(1);
+  return LETTER_COMMANDS[static_cast<u8>(first)];
 }
 
 std::string ProcessPacket(std::string_view data)
@@ -324,35 +520,35 @@ std::string ProcessPacket(std::string_view data)
     trimmedData = trimmedData.substr(1);
   }
 
+  // Acknowledgement is decided before processing, so the reply to QStartNoAckMode is still acked.
+  const bool send_ack = !s_no_ack_mode;
+
   // Validate packet.
   auto packet = DeserializePacket(trimmedData);
   if (!packet)
   {
     ERROR_LOG("Malformed packet '{}'", trimmedData);
-    return "-";
+    return send_ack ? "-" : "";
   }
 
   std::optional<std::string> reply = {""};
 
   // Try to invoke packet command.
-  bool processed = false;
-  for (const auto& command : COMMANDS)
+  std::string_view payload;
+  if (const CommandHandler handler = LookupCommand(*packet, &payload))
   {
-    if (packet->starts_with(command.first))
-    {
-      DEBUG_LOG("Processing command '{}'", command.first);
-
-      // Invoke command, remove command name from payload.
-      reply = command.second(packet->substr(strlen(command.first)));
-      processed = true;
-      break;
-    }
+    DEBUG_LOG("Processing command '{}'", packet->substr(0, packet->size() - payload.size()));
+    reply = handler(payload);
   }
-
-  if (!processed)
+  else
+  {
     WARNING_LOG("Failed to process packet '{}'", trimmedData);
+  }
+
+  if (!reply)
+    return send_ack ? "+" : "";
 
-  return reply ? "+" + SerializePacket(*reply) : "+";
+  return send_ack ? ("+" + SerializePacket(*reply)) : SerializePacket(*reply);
 }
 
 } // namespace GDBProtocol
@@ -386,7 +582,7 @@ static std::vector<std::shared_ptr<ClientSocket>> s_gdb_clients;
 } // namespace GDBServer
 
 GDBServer::ClientSocket::ClientSocket(SocketMultiplexer& multiplexer, SocketDescriptor descriptor)
-  : BufferedStreamSocket(multiplexer, descriptor, 65536, 65536)
+  : BufferedStreamSocket(multiplexer, descriptor, GDBProtocol::MAX_PACKET_SIZE * 2, GDBProtocol::MAX_PACKET_SIZE * 4)
 {
 }
 
@@ -399,6 +595,9 @@ void GDBServer::ClientSocket::OnConnected()
   m_seen_resume = System::IsPaused();
   System::PauseSystem(true);
 
+  // new connections always start with acknowledgements
+  GDBProtocol::s_no_ack_mode = false;
+
   s_gdb_clients.push_back(std::static_pointer_cast<ClientSocket>(shared_from_this()));
 }
 
@@ -423,49 +622,55 @@ void GDBServer::ClientSocket::OnRead()
   if (buffer.empty())
     return;
 
+  const std::string_view data(reinterpret_cast<const char*>(buffer.data()), buffer.size());
   size_t buffer_offset = 0;
-  while (buffer_offset < buffer.size())
+  while (buffer_offset < data.size())
   {
-    size_t current_packet_size = 1;
-    bool packet_complete = false;
-    for (; (buffer_offset + current_packet_size) <= buffer.size(); current_packet_size++)
+    const char ch = data[buffer_offset];
+    if (ch == '+' || ch == '-')
     {
-      const std::string_view current_packet(reinterpret_cast<const char*>(buffer.data() + buffer_offset),
-                                            current_packet_size);
+      // acks for our replies
+      if (ch == '-')
+        ERROR_LOG("Received negative ack");
 
-      if (GDBProtocol::IsPacketInterrupt(current_packet))
-      {
-        DEV_LOG("{} > Interrupt request", GetRemoteAddress().ToString());
-        System::PauseSystem(true);
-        packet_complete = true;
-        break;
-      }
-      else if (GDBProtocol::IsPacketContinue(current_packet))
-      {
-        DEV_LOG("{} > Continue request", GetRemoteAddress().ToString());
-        System::PauseSystem(false);
-        packet_complete = true;
-        break;
-      }
-      else if (GDBProtocol::IsPacketComplete(current_packet))
-      {
-        // TODO: Make this not copy.
-        DEV_LOG("{} > {}", GetRemoteAddress().ToString(), current_packet);
-        SendPacket(GDBProtocol::ProcessPacket(current_packet));
-        packet_complete = true;
-        break;
-      }
+      buffer_offset++;
+      continue;
+    }
+    else if (ch == '\003')
+    {
+      // only an interrupt outside of a packet, binary payloads can contain it
+      DEV_LOG("{} > Interrupt request", GetRemoteAddress().ToString());
+      System::PauseSystem(true);
+      buffer_offset++;
+      continue;
+    }
+    else if (ch != '$')
+    {
+      WARNING_LOG("Skipping unexpected character 0x{:02X}", static_cast<u8>(ch));
+      buffer_offset++;
+      continue;
     }
 
-    if (!packet_complete)
+    // '#' is always escaped inside packets, so the first one ends it, followed by the checksum
+    const std::string_view::size_type end = data.find('#', buffer_offset + 1);
+    if (end == std::string_view::npos || (end + 2) >= data.size())
     {
-      WARNING_LOG("Incomplete packet, got {} bytes.", buffer.size() - buffer_offset);
+      DEV_LOG("Incomplete packet, got {} bytes.", data.size() - buffer_offset);
       break;
     }
-    else
+
+    const std::string_view current_packet = data.substr(buffer_offset, end + 3 - buffer_offset);
+    buffer_offset = end + 3;
+
+    if (current_packet == "$c#63")
     {
-      buffer_offset += current_packet_size;
+      DEV_LOG("{} > Continue request", GetRemoteAddress().ToString());
+      System::PauseSystem(false);
+      continue;
     }
+
+    DEV_LOG("{} > {}", GetRemoteAddress().ToString(), current_packet.substr(0, 64));
+    SendPacket(GDBProtocol::ProcessPacket(current_packet));
   }
 
   ReleaseReadBuffer(buffer_offset);
@@ -476,7 +681,7 @@ void GDBServer::ClientSocket::SendPacket(std::string_view sv)
   if (sv.empty())
     return;
 
-  WARNING_LOG("Write: {}", sv);
+  DEV_LOG("Write: {}", sv.substr(0, 64));
   if (size_t written = Write(sv.data(), sv.length()); written != sv.length())
     ERROR_LOG("Only wrote {} of {} bytes.", written, sv.length());
 }
@@ -497,7 +702,8 @@ void GDBServer::ClientSocket::OnSystemResumed()
   m_seen_resume = true;
 
   // Send ack, in case GDB sent a continue request.
-  SendPacket("+");
+  if (!GDBProtocol::s_no_ack_mode)
+    SendPacket("+");
 }
 
 bool GDBServer::Initialize(u16 port)
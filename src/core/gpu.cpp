@@ -26,12 +26,15 @@
 #include "common/path.h"
 #include "common/small_string.h"
 #include "common/string_util.h"
+#include "common/task_scheduler.h"
 
 #include "IconsEmoji.h"
 #include "fmt/format.h"
 #include "imgui.h"
 
 #include <cmath>
+#include <memory>
+#include <mutex>
 #include <numbers>
 #include <thread>
 
@@ -50,8 +53,36 @@ static TimingEvent s_command_tick_event(
   "GPU Command Tick", 1, 1, [](void* param, TickCount ticks, TickCount ticks_late) { g_gpu->CommandTickEvent(ticks); },
   nullptr);
 
-static std::deque<std::thread> s_screenshot_threads;
-static std::mutex s_screenshot_threads_mutex;
+namespace {
+struct ScreenshotJob
+{
+  u32 width;
+  u32 height;
+  std::string filename;
+  FileSystem::ManagedCFilePtr fp;
+  u8 quality;
+  bool clear_alpha;
+  bool flip_y;
+  std::vector<u32> texture_data;
+  u32 texture_data_stride;
+  GPUTexture::Format texture_format;
+  std::string osd_key;
+};
+
+struct ScreenshotEncoderState
+{
+  TaskGroup tasks;
+  std::mutex buffer_mutex;
+  std::vector<std::vector<u32>> free_buffers;
+};
+} // namespace
+
+// Encoding is slow, so the CPU thread blocks once this many screenshots are in flight. Burst capture then runs in
+// constant memory, instead of allocating a new buffer for every screenshot.
+static constexpr u32 MAX_QUEUED_SCREENSHOTS = 4;
+static constexpr u32 MAX_FREE_SCREENSHOT_BUFFERS = 2;
+
+static ScreenshotEncoderState s_screenshot_encoder;
 
 // #define PSX_GPU_STATS
 #ifdef PSX_GPU_STATS
@@ -65,7 +96,10 @@ static bool CompressAndWriteTextureToFile(u32 width, u32 height, std::string fil
                                           u8 quality, bool clear_alpha, bool flip_y, std::vector<u32> texture_data,
                                           u32 texture_data_stride, GPUTexture::Format texture_format,
                                           bool display_osd_message, bool use_thread);
-static void JoinScreenshotThreads();
+static bool EncodeScreenshot(ScreenshotJob& job);
+static std::vector<u32> AcquireScreenshotBuffer(size_t size);
+static void ReleaseScreenshotBuffer(std::vector<u32> buffer);
+static void WaitForScreenshots();
 
 GPU::GPU()
 {
@@ -77,7 +111,7 @@ GPU::~GPU()
   s_command_tick_event.Deactivate();
   s_crtc_tick_event.Deactivate();
 
-  JoinScreenshotThreads();
+  WaitForScreenshots();
   DestroyDeinterlaceTextures();
   g_gpu_device->RecycleTexture(std::move(m_chroma_smoothing_texture));
 
@@ -508,6 +542,28 @@ void GPU::EndDMAWrite()
   ExecuteCommands();
 }
 
+void GPU::DMAWriteBlock(u32 address, const u8* ram_ptr, u32 word_count)
+{
+  // Queued words have to be executed first, so the block goes behind them.
+  if (!m_fifo.IsEmpty())
+  {
+    for (u32 i = 0; i < word_count; i++)
+    {
+      u32 value;
+      std::memcpy(&value, ram_ptr + (i * sizeof(value)), sizeof(value));
+      DMAWrite(address + (i * sizeof(value)), value);
+    }
+
+    ExecuteCommands();
+    return;
+  }
+
+  m_dma_block_ptr = ram_ptr;
+  m_dma_block_address = address;
+  m_dma_block_words = word_count;
+  ExecuteCommands();
+}
+
 /**
  * NTSC GPU clock 53.693175 MHz
  * PAL GPU clock 53.203425 MHz
@@ -1006,8 +1062,10 @@ void GPU::CRTCTickEvent(TickCount ticks)
 
         // flush any pending draws and "scan out" the image
         // TODO: move present in here I guess
+        // runahead catch-up frames never get displayed, so skip the copy-out/deinterlace/chroma smoothing passes.
         FlushRender();
-        UpdateDisplay();
+        if (!System::IsRunaheadReplayFrame())
+          UpdateDisplay();
         frame_done = true;
 
         // switch fields early. this is needed so we draw to the correct one.
@@ -2531,102 +2589,150 @@ bool CompressAndWriteTextureToFile(u32 width, u32 height, std::string filename,
                             60.0f);
   }
 
-  static constexpr auto proc = [](u32 width, u32 height, std::string filename, FileSystem::ManagedCFilePtr fp,
-                                  u8 quality, bool clear_alpha, bool flip_y, std::vector<u32> texture_data,
-                                  u32 texture_data_stride, GPUTexture::Format texture_format, std::string osd_key,
-                                  bool use_thread) {
-    bool result;
+  ScreenshotJob job = {width,
+                       height,
+                       std::move(filename),
+                       std::move(fp),
+                       quality,
+                       clear_alpha,
+                       flip_y,
+                       std::move(texture_data),
+                       texture_data_stride,
+                       texture_format,
+                       std::move(osd_key)};
+  if (!use_thread)
+  {
+    const bool result = EncodeScreenshot(job);
+    ReleaseScreenshotBuffer(std::move(job.texture_data));
+    return result;
+  }
 
-    const char* extension = std::strrchr(filename.c_str(), '.');
-    if (extension)
+  if (s_screenshot_encoder.tasks.GetPendingCount() >= MAX_QUEUED_SCREENSHOTS)
+  {
+    DEV_LOG("Screenshot queue is full, waiting for encoder.");
+    s_screenshot_encoder.tasks.Wait(MAX_QUEUED_SCREENSHOTS - 1);
+  }
+
+  // std::function needs a copyable callable, so the job has to live on the heap.
+  s_screenshot_encoder.tasks.Submit(
+    [job = std::make_shared<ScreenshotJob>(std::move(job))]() {
+      // The caller was only told the write was queued, so failures have to be reported from here.
+      const bool has_osd_message = !job->osd_key.empty();
+      if (!EncodeScreenshot(*job) && !has_osd_message)
+      {
+        Host::AddIconOSDMessage(fmt::format("ScreenshotSaver_{}", job->filename), ICON_EMOJI_CAMERA,
+                                fmt::format(TRANSLATE_FS("GPU", "Failed to save '{}'."),
+                                            Path::GetFileName(job->filename)),
+                                Host::OSD_ERROR_DURATION);
+      }
+
+      ReleaseScreenshotBuffer(std::move(job->texture_data));
+    },
+    TaskScheduler::Priority::Low);
+  return true;
+}
+
+bool EncodeScreenshot(ScreenshotJob& job)
+{
+  bool result;
+
+  const char* extension = std::strrchr(job.filename.c_str(), '.');
+  if (extension)
+  {
+    if (GPUTexture::ConvertTextureDataToRGBA8(job.width, job.height, job.texture_data, job.texture_data_stride,
+                                              job.texture_format))
     {
-      if (GPUTexture::ConvertTextureDataToRGBA8(width, height, texture_data, texture_data_stride, texture_format))
+      if (job.clear_alpha)
       {
-        if (clear_alpha)
-        {
-          for (u32& pixel : texture_data)
-            pixel |= 0xFF000000u;
-        }
+        for (u32& pixel : job.texture_data)
+          pixel |= 0xFF000000u;
+      }
 
-        if (flip_y)
-          GPUTexture::FlipTextureDataRGBA8(width, height, reinterpret_cast<u8*>(texture_data.data()),
-                                           texture_data_stride);
+      if (job.flip_y)
+      {
+        GPUTexture::FlipTextureDataRGBA8(job.width, job.height, reinterpret_cast<u8*>(job.texture_data.data()),
+                                         job.texture_data_stride);
+      }
 
-        Assert(texture_data_stride == sizeof(u32) * width);
-        RGBA8Image image(width, height, std::move(texture_data));
-        if (image.SaveToFile(filename.c_str(), fp.get(), quality))
-        {
-          result = true;
-        }
-        else
-        {
-          ERROR_LOG("Unknown extension in filename '{}' or save error: '{}'", filename, extension);
-          result = false;
-        }
+      Assert(job.texture_data_stride == sizeof(u32) * job.width);
+      RGBA8Image image(job.width, job.height, std::move(job.texture_data));
+      if (image.SaveToFile(job.filename.c_str(), job.fp.get(), job.quality))
+      {
+        result = true;
       }
       else
       {
+        ERROR_LOG("Unknown extension in filename '{}' or save error: '{}'", job.filename, extension);
         result = false;
       }
+
+      // Hand the pixels back so the buffer can be reused.
+      job.texture_data = image.TakePixels();
     }
     else
     {
-      ERROR_LOG("Unable to determine file extension for '{}'", filename);
       result = false;
     }
+  }
+  else
+  {
+    ERROR_LOG("Unable to determine file extension for '{}'", job.filename);
+    result = false;
+  }
 
-    if (!osd_key.empty())
-    {
-      Host::AddIconOSDMessage(std::move(osd_key), ICON_EMOJI_CAMERA,
-                              fmt::format(result ? TRANSLATE_FS("GPU", "Saved screenshot to '{}'.") :
-                                                   TRANSLATE_FS("GPU", "Failed to save screenshot to '{}'."),
-                                          Path::GetFileName(filename),
-                                          result ? Host::OSD_INFO_DURATION : Host::OSD_ERROR_DURATION));
-    }
-
-    if (use_thread)
-    {
-      // remove ourselves from the list, if the GS thread is waiting for us, we won't be in there
-      const auto this_id = std::this_thread::get_id();
-      std::unique_lock lock(s_screenshot_threads_mutex);
-      for (auto it = s_screenshot_threads.begin(); it != s_screenshot_threads.end(); ++it)
-      {
-        if (it->get_id() == this_id)
-        {
-          it->detach();
-          s_screenshot_threads.erase(it);
-          break;
-        }
-      }
-    }
-
-    return result;
-  };
+  job.fp.reset();
 
-  if (!use_thread)
+  if (!job.osd_key.empty())
   {
-    return proc(width, height, std::move(filename), std::move(fp), quality, clear_alpha, flip_y,
-                std::move(texture_data), texture_data_stride, texture_format, std::move(osd_key), use_thread);
+    Host::AddIconOSDMessage(std::move(job.osd_key), ICON_EMOJI_CAMERA,
+                            fmt::format(result ? TRANSLATE_FS("GPU", "Saved screenshot to '{}'.") :
+                                                 TRANSLATE_FS("GPU", "Failed to save screenshot to '{}'."),
+                                        Path::GetFileName(job.filename),
+                                        result ? Host::OSD_INFO_DURATION : Host::OSD_ERROR_DURATION));
   }
 
-  std::unique_lock lock(s_screenshot_threads_mutex);
-  std::thread thread(proc, width, height, std::move(filename), std::move(fp), quality, clear_alpha, flip_y,
-                     std::move(texture_data), texture_data_stride, texture_format, std::move(osd_key), use_thread);
-  s_screenshot_threads.push_back(std::move(thread));
-  return true;
+  return result;
 }
 
-void JoinScreenshotThreads()
+std::vector<u32> AcquireScreenshotBuffer(size_t size)
 {
-  std::unique_lock lock(s_screenshot_threads_mutex);
-  while (!s_screenshot_threads.empty())
+  std::vector<u32> buffer;
   {
-    std::thread save_thread(std::move(s_screenshot_threads.front()));
-    s_screenshot_threads.pop_front();
-    lock.unlock();
-    save_thread.join();
-    lock.lock();
+    std::unique_lock lock(s_screenshot_encoder.buffer_mutex);
+    if (!s_screenshot_encoder.free_buffers.empty())
+    {
+      // Prefer a buffer which won't need to grow, screenshots are usually all the same size.
+      auto it = std::find_if(s_screenshot_encoder.free_buffers.begin(), s_screenshot_encoder.free_buffers.end(),
+                             [size](const std::vector<u32>& buf) { return (buf.capacity() >= size); });
+      if (it == s_screenshot_encoder.free_buffers.end())
+        it = s_screenshot_encoder.free_buffers.begin();
+
+      buffer = std::move(*it);
+      s_screenshot_encoder.free_buffers.erase(it);
+    }
   }
+
+  buffer.resize(size);
+  return buffer;
+}
+
+void ReleaseScreenshotBuffer(std::vector<u32> buffer)
+{
+  if (buffer.capacity() == 0)
+    return;
+
+  std::unique_lock lock(s_screenshot_encoder.buffer_mutex);
+  if (s_screenshot_encoder.free_buffers.size() < MAX_FREE_SCREENSHOT_BUFFERS)
+    s_screenshot_encoder.free_buffers.push_back(std::move(buffer));
+}
+
+void WaitForScreenshots()
+{
+  // Anything still queued gets written out first.
+  s_screenshot_encoder.tasks.Wait();
+
+  std::unique_lock lock(s_screenshot_encoder.buffer_mutex);
+  s_screenshot_encoder.free_buffers.clear();
 }
 
 bool GPU::WriteDisplayTextureToFile(std::string filename, bool compress_on_thread /* = false */)
@@ -2641,7 +2747,7 @@ bool GPU::WriteDisplayTextureToFile(std::string filename, bool compress_on_threa
 
   const u32 texture_data_stride =
     Common::AlignUpPow2(GPUTexture::GetPixelSize(m_display_texture->GetFormat()) * read_width, 4);
-  std::vector<u32> texture_data((texture_data_stride * read_height) / sizeof(u32));
+  std::vector<u32> texture_data = AcquireScreenshotBuffer((texture_data_stride * read_height) / sizeof(u32));
 
   std::unique_ptr<GPUDownloadTexture> dltex;
   if (g_gpu_device->GetFeatures().memory_import)
@@ -2806,7 +2912,7 @@ bool GPU::RenderScreenshotToFile(std::string filename, DisplayScreenshotMode mod
   if (width == 0 || height == 0)
     return false;
 
-  std::vector<u32> pixels;
+  std::vector<u32> pixels = AcquireScreenshotBuffer(width * height);
   u32 pixels_stride;
   GPUTexture::Format pixels_format;
   if (!RenderScreenshotToBuffer(width, height, display_rect, draw_rect, !internal_resolution, &pixels, &pixels_stride,
@@ -2851,13 +2957,14 @@ bool GPU::DumpVRAMToFile(const char* filename)
 
 bool GPU::DumpVRAMToFile(const char* filename, u32 width, u32 height, u32 stride, const void* buffer, bool remove_alpha)
 {
-  RGBA8Image image(width, height);
+  // Convert now, the source may be overwritten before the encoder gets to it.
+  std::vector<u32> pixels = AcquireScreenshotBuffer(width * height);
 
   const char* ptr_in = static_cast<const char*>(buffer);
   for (u32 row = 0; row < height; row++)
   {
     const char* row_ptr_in = ptr_in;
-    u32* ptr_out = image.GetRowPixels(row);
+    u32* ptr_out = &pixels[row * width];
 
     for (u32 col = 0; col < width; col++)
     {
@@ -2870,7 +2977,17 @@ bool GPU::DumpVRAMToFile(const char* filename, u32 width, u32 height, u32 stride
     ptr_in += stride;
   }
 
-  return image.SaveToFile(filename);
+  Error error;
+  auto fp = FileSystem::OpenManagedCFile(filename, "wb", &error);
+  if (!fp)
+  {
+    ERROR_LOG("Can't open file '{}': {}", Path::GetFileName(filename), error.GetDescription());
+    return false;
+  }
+
+  return CompressAndWriteTextureToFile(width, height, filename, std::move(fp), RGBA8Image::DEFAULT_SAVE_QUALITY, false,
+                                       false, std::move(pixels), sizeof(u32) * width, GPUTexture::Format::RGBA8, false,
+                                       true);
 }
 
 void GPU::DrawDebugStateWindow()
@@ -15,6 +15,7 @@
 
 #include <algorithm>
 #include <array>
+#include <cstring>
 #include <deque>
 #include <memory>
 #include <string>
@@ -126,6 +127,10 @@ public:
   }
   void EndDMAWrite();
 
+  /// Writes a contiguous block of guest RAM. If the FIFO is empty, commands are parsed directly from RAM, and only
+  /// the words which can't be executed yet are queued. Replaces the DMAWrite()/EndDMAWrite() sequence.
+  void DMAWriteBlock(u32 address, const u8* ram_ptr, u32 word_count);
+
   /// Returns true if no data is being sent from VRAM to the DAC or that no portion of VRAM would be visible on screen.
   ALWAYS_INLINE bool IsDisplayDisabled() const
   {
@@ -147,6 +152,15 @@ public:
   /// Returns true if we're in PAL mode, otherwise false if NTSC.
   ALWAYS_INLINE bool IsInPALMode() const { return m_GPUSTAT.pal_mode; }
 
+  /// Returns a value which identifies the current display mode, used to tell apart FMVs, menus, gameplay, etc.
+  ALWAYS_INLINE u32 GetDisplayModeKey() const
+  {
+    return (static_cast<u32>(m_crtc_state.display_width) | (static_cast<u32>(m_crtc_state.display_height) << 12) |
+            (BoolToUInt32(m_GPUSTAT.vertical_interlace) << 24) |
+            (BoolToUInt32(m_GPUSTAT.display_area_color_depth_24) << 25) |
+            (BoolToUInt32(IsDisplayDisabled()) << 26));
+  }
+
   /// Returns the number of pending GPU ticks.
   TickCount GetPendingCRTCTicks() const;
   TickCount GetPendingCommandTicks() const;
@@ -205,7 +219,8 @@ public:
   void CRTCTickEvent(TickCount ticks);
   void CommandTickEvent(TickCount ticks);
 
-  // Dumps raw VRAM to a file.
+  // Dumps raw VRAM to a file. PNG dumps are encoded and written on the screenshot pool, so true only means the dump
+  // was queued, write errors are reported through the OSD instead.
   bool DumpVRAMToFile(const char* filename);
 
   // Ensures all buffered vertices are drawn.
@@ -261,6 +276,7 @@ protected:
     return std::make_tuple(static_cast<u8>(rgb24), static_cast<u8>(rgb24 >> 8), static_cast<u8>(rgb24 >> 16));
   }
 
+  // Converts and queues the image for writing on the screenshot pool. Returns false if the file can't be opened.
   static bool DumpVRAMToFile(const char* filename, u32 width, u32 height, u32 stride, const void* buffer,
                              bool remove_alpha);
 
@@ -618,9 +634,62 @@ protected:
   u32 m_blit_remaining_words;
   GPURenderCommand m_render_command{};
 
-  ALWAYS_INLINE u32 FifoPop() { return Truncate32(m_fifo.Pop()); }
-  ALWAYS_INLINE u32 FifoPeek() { return Truncate32(m_fifo.Peek()); }
-  ALWAYS_INLINE u32 FifoPeek(u32 i) { return Truncate32(m_fifo.Peek(i)); }
+  /// Block of guest RAM being parsed in place by DMAWriteBlock(). Only non-empty while the FIFO is empty, so the
+  /// command queue is always one or the other. Any words left over are moved to the FIFO before returning.
+  const u8* m_dma_block_ptr = nullptr;
+  u32 m_dma_block_address = 0;
+  u32 m_dma_block_words = 0;
+
+  ALWAYS_INLINE u32 GetCommandQueueSize() const { return m_fifo.GetSize() + m_dma_block_words; }
+  ALWAYS_INLINE bool IsCommandQueueEmpty() const { return (m_dma_block_words == 0 && m_fifo.IsEmpty()); }
+
+  ALWAYS_INLINE u32 FifoPop()
+  {
+    if (m_dma_block_words > 0)
+    {
+      u32 value;
+      std::memcpy(&value, m_dma_block_ptr, sizeof(value));
+      m_dma_block_ptr += sizeof(value);
+      m_dma_block_address += sizeof(value);
+      m_dma_block_words--;
+      return value;
+    }
+
+    return Truncate32(m_fifo.Pop());
+  }
+  ALWAYS_INLINE u64 FifoPopWithAddress()
+  {
+    if (m_dma_block_words > 0)
+    {
+      const u32 address = m_dma_block_address;
+      return (ZeroExtend64(address) << 32) | ZeroExtend64(FifoPop());
+    }
+
+    return m_fifo.Pop();
+  }
+  ALWAYS_INLINE u32 FifoPeek(u32 i = 0)
+  {
+    if (m_dma_block_words > 0)
+    {
+      u32 value;
+      std::memcpy(&value, m_dma_block_ptr + (i * sizeof(value)), sizeof(value));
+      return value;
+    }
+
+    return Truncate32(m_fifo.Peek(i));
+  }
+  ALWAYS_INLINE void FifoRemoveOne()
+  {
+    if (m_dma_block_words > 0)
+    {
+      m_dma_block_ptr += sizeof(u32);
+      m_dma_block_address += sizeof(u32);
+      m_dma_block_words--;
+      return;
+    }
+
+    m_fifo.RemoveOne();
+  }
 
   TickCount m_max_run_ahead = 128;
   u32 m_fifo_size = 128;
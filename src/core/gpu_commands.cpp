@@ -13,7 +13,7 @@
 Log_SetChannel(GPU);
 
 #define CHECK_COMMAND_SIZE(num_words)                                                                                  \
-  if (m_fifo.GetSize() < num_words)                                                                                    \
+  if (GetCommandQueueSize() < num_words)                                                                               \
   {                                                                                                                    \
     m_command_total_words = num_words;                                                                                 \
     return false;                                                                                                      \
@@ -29,7 +29,7 @@ static constexpr u32 ReplaceZero(u32 value, u32 value_for_zero)
 
 void GPU::TryExecuteCommands()
 {
-  while (m_pending_command_ticks <= m_max_run_ahead && !m_fifo.IsEmpty())
+  while (m_pending_command_ticks <= m_max_run_ahead && !IsCommandQueueEmpty())
   {
     switch (m_blitter_state)
     {
@@ -45,7 +45,7 @@ void GPU::TryExecuteCommands()
       case BlitterState::WritingVRAM:
       {
         DebugAssert(m_blit_remaining_words > 0);
-        const u32 words_to_copy = std::min(m_blit_remaining_words, m_fifo.GetSize());
+        const u32 words_to_copy = std::min(m_blit_remaining_words, GetCommandQueueSize());
         m_blit_buffer.reserve(m_blit_buffer.size() + words_to_copy);
         for (u32 i = 0; i < words_to_copy; i++)
           m_blit_buffer.push_back(FifoPop());
@@ -69,7 +69,7 @@ void GPU::TryExecuteCommands()
         const u32 words_per_vertex = m_render_command.shading_enable ? 2 : 1;
         u32 terminator_index =
           m_render_command.shading_enable ? ((static_cast<u32>(m_blit_buffer.size()) & 1u) ^ 1u) : 0u;
-        for (; terminator_index < m_fifo.GetSize(); terminator_index += words_per_vertex)
+        for (; terminator_index < GetCommandQueueSize(); terminator_index += words_per_vertex)
         {
           // polyline must have at least two vertices, and the terminator is (word & 0xf000f000) == 0x50005000.
           // terminator is on the first word for the vertex
@@ -77,8 +77,8 @@ void GPU::TryExecuteCommands()
             break;
         }
 
-        const bool found_terminator = (terminator_index < m_fifo.GetSize());
-        const u32 words_to_copy = std::min(terminator_index, m_fifo.GetSize());
+        const bool found_terminator = (terminator_index < GetCommandQueueSize());
+        const u32 words_to_copy = std::min(terminator_index, GetCommandQueueSize());
         if (words_to_copy > 0)
         {
           m_blit_buffer.reserve(m_blit_buffer.size() + words_to_copy);
@@ -90,7 +90,7 @@ void GPU::TryExecuteCommands()
         if (found_terminator)
         {
           // drop terminator
-          m_fifo.RemoveOne();
+          FifoRemoveOne();
           DEBUG_LOG("Drawing poly-line with {} vertices", GetPolyLineVertexCount());
           DispatchRenderCommand();
           m_blit_buffer.clear();
@@ -108,6 +108,21 @@ void GPU::ExecuteCommands()
   const bool was_executing_from_event = std::exchange(m_executing_commands, true);
 
   TryExecuteCommands();
+
+  // Anything left in a DMA block being parsed in place has to be queued, the guest is free to overwrite it afterwards.
+  if (m_dma_block_words > 0)
+  {
+    for (; m_dma_block_words > 0; m_dma_block_words--)
+    {
+      u32 value;
+      std::memcpy(&value, m_dma_block_ptr, sizeof(value));
+      m_fifo.Push((ZeroExtend64(m_dma_block_address) << 32) | ZeroExtend64(value));
+      m_dma_block_ptr += sizeof(value);
+      m_dma_block_address += sizeof(value);
+    }
+  }
+  m_dma_block_ptr = nullptr;
+
   UpdateDMARequest();
   UpdateGPUIdle();
 
@@ -180,18 +195,18 @@ bool GPU::HandleUnknownGP0Command()
   ERROR_LOG("Unimplemented GP0 command 0x{:02X}", command);
 
   SmallString dump;
-  for (u32 i = 0; i < m_fifo.GetSize(); i++)
+  for (u32 i = 0; i < GetCommandQueueSize(); i++)
     dump.append_format("{}{:08X}", (i > 0) ? " " : "", FifoPeek(i));
   ERROR_LOG("FIFO: {}", dump);
 
-  m_fifo.RemoveOne();
+  FifoRemoveOne();
   EndCommand();
   return true;
 }
 
 bool GPU::HandleNOPCommand()
 {
-  m_fifo.RemoveOne();
+  FifoRemoveOne();
   EndCommand();
   return true;
 }
@@ -201,7 +216,7 @@ bool GPU::HandleClearCacheCommand()
   DEBUG_LOG("GP0 clear cache");
   m_draw_mode.SetTexturePageChanged();
   InvalidateCLUT();
-  m_fifo.RemoveOne();
+  FifoRemoveOne();
   AddCommandTicks(1);
   EndCommand();
   return true;
@@ -214,7 +229,7 @@ bool GPU::HandleInterruptRequestCommand()
   m_GPUSTAT.interrupt_request = true;
   InterruptController::SetLineState(InterruptController::IRQ::GPU, true);
 
-  m_fifo.RemoveOne();
+  FifoRemoveOne();
   AddCommandTicks(1);
   EndCommand();
   return true;
@@ -357,7 +372,7 @@ bool GPU::HandleRenderPolygonCommand()
   m_counters.num_vertices += num_vertices;
   m_counters.num_primitives++;
   m_render_command.bits = rc.bits;
-  m_fifo.RemoveOne();
+  FifoRemoveOne();
 
   DispatchRenderCommand();
   EndCommand();
@@ -391,7 +406,7 @@ bool GPU::HandleRenderRectangleCommand()
   m_counters.num_vertices++;
   m_counters.num_primitives++;
   m_render_command.bits = rc.bits;
-  m_fifo.RemoveOne();
+  FifoRemoveOne();
 
   DispatchRenderCommand();
   EndCommand();
@@ -413,7 +428,7 @@ bool GPU::HandleRenderLineCommand()
   m_counters.num_vertices += 2;
   m_counters.num_primitives++;
   m_render_command.bits = rc.bits;
-  m_fifo.RemoveOne();
+  FifoRemoveOne();
 
   DispatchRenderCommand();
   EndCommand();
@@ -437,7 +452,7 @@ bool GPU::HandleRenderPolyLineCommand()
             rc.shading_enable ? "shaded" : "monochrome", setup_ticks);
 
   m_render_command.bits = rc.bits;
-  m_fifo.RemoveOne();
+  FifoRemoveOne();
 
   const u32 words_to_pop = min_words - 1;
   // m_blit_buffer.resize(words_to_pop);
@@ -481,7 +496,7 @@ bool GPU::HandleFillRectangleCommand()
 bool GPU::HandleCopyRectangleCPUToVRAMCommand()
 {
   CHECK_COMMAND_SIZE(3);
-  m_fifo.RemoveOne();
+  FifoRemoveOne();
 
   const u32 coords = FifoPop();
   const u32 size = FifoPop();
@@ -576,7 +591,7 @@ void GPU::FinishVRAMWrite()
 bool GPU::HandleCopyRectangleVRAMToCPUCommand()
 {
   CHECK_COMMAND_SIZE(3);
-  m_fifo.RemoveOne();
+  FifoRemoveOne();
 
   m_vram_transfer.x = Truncate16(FifoPeek() & VRAM_WIDTH_MASK);
   m_vram_transfer.y = Truncate16((FifoPop() >> 16) & VRAM_HEIGHT_MASK);
@@ -610,7 +625,7 @@ bool GPU::HandleCopyRectangleVRAMToCPUCommand()
 bool GPU::HandleCopyRectangleVRAMToVRAMCommand()
 {
   CHECK_COMMAND_SIZE(4);
-  m_fifo.RemoveOne();
+  FifoRemoveOne();
 
   const u32 src_x = FifoPeek() & VRAM_WIDTH_MASK;
   const u32 src_y = (FifoPop() >> 16) & VRAM_HEIGHT_MASK;
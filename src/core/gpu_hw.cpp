@@ -306,7 +306,7 @@ bool GPU_HW::DoState(StateWrapper& sw, GPUTexture** host_texture, bool update_di
   // Need to download local VRAM copy before calling the base class, because it serializes this.
   if (m_sw_renderer)
   {
-    m_sw_renderer->Sync(true);
+    m_sw_renderer->PreDoState(sw.IsReading());
   }
   else if (sw.IsWriting() && !host_texture)
   {
@@ -320,6 +320,9 @@ bool GPU_HW::DoState(StateWrapper& sw, GPUTexture** host_texture, bool update_di
   if (!GPU::DoState(sw, host_texture, update_display))
     return false;
 
+  if (m_sw_renderer)
+    m_sw_renderer->PostDoState(sw.IsReading());
+
   if (host_texture)
   {
     GPUTexture* tex = *host_texture;
@@ -2359,7 +2362,7 @@ void GPU_HW::LoadVertices()
       {
         const u32 vert_color = (shaded && i > 0) ? (FifoPop() & UINT32_C(0x00FFFFFF)) : first_color;
         const u32 color = raw_texture ? UINT32_C(0x00808080) : vert_color;
-        const u64 maddr_and_pos = m_fifo.Pop();
+        const u64 maddr_and_pos = FifoPopWithAddress();
         const GPUVertexPosition vp{Truncate32(maddr_and_pos)};
         const u16 texcoord = textured ? Truncate16(FifoPop()) : 0;
         const s32 native_x = native_vertex_positions[i].x = m_drawing_offset.x + vp.x;
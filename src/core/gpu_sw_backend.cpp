@@ -24,6 +24,7 @@ bool GPU_SW_Backend::Initialize(bool force_thread)
 void GPU_SW_Backend::Reset()
 {
   GPUBackend::Reset();
+  InvalidateCLUTCache();
 }
 
 void GPU_SW_Backend::DrawPolygon(const GPUBackendDrawPolygonCommand* cmd)
@@ -31,8 +32,12 @@ void GPU_SW_Backend::DrawPolygon(const GPUBackendDrawPolygonCommand* cmd)
   const GPURenderCommand rc{cmd->rc.bits};
   const bool dithering_enable = rc.IsDitheringEnabled() && cmd->draw_mode.dither_enable;
 
-  const GPU_SW_Rasterizer::DrawTriangleFunction DrawFunction = GPU_SW_Rasterizer::GetDrawTriangleFunction(
-    rc.shading_enable, rc.texture_enable, rc.raw_texture_enable, rc.transparency_enable, dithering_enable);
+  const bool texture_window_enable = rc.texture_enable && GPU_SW_Rasterizer::IsTextureWindowActive(cmd->window);
+  m_drawing_area_written = true;
+
+  const GPU_SW_Rasterizer::DrawTriangleFunction DrawFunction =
+    GPU_SW_Rasterizer::GetDrawTriangleFunction(rc.shading_enable, rc.texture_enable, rc.raw_texture_enable,
+                                               rc.transparency_enable, dithering_enable, texture_window_enable);
 
   DrawFunction(cmd, &cmd->vertices[0], &cmd->vertices[1], &cmd->vertices[2]);
   if (rc.quad_polygon)
@@ -42,15 +47,19 @@ void GPU_SW_Backend::DrawPolygon(const GPUBackendDrawPolygonCommand* cmd)
 void GPU_SW_Backend::DrawRectangle(const GPUBackendDrawRectangleCommand* cmd)
 {
   const GPURenderCommand rc{cmd->rc.bits};
+  const bool texture_window_enable = rc.texture_enable && GPU_SW_Rasterizer::IsTextureWindowActive(cmd->window);
+  m_drawing_area_written = true;
 
-  const GPU_SW_Rasterizer::DrawRectangleFunction DrawFunction =
-    GPU_SW_Rasterizer::GetDrawRectangleFunction(rc.texture_enable, rc.raw_texture_enable, rc.transparency_enable);
+  const GPU_SW_Rasterizer::DrawRectangleFunction DrawFunction = GPU_SW_Rasterizer::GetDrawRectangleFunction(
+    rc.texture_enable, rc.raw_texture_enable, rc.transparency_enable, texture_window_enable);
 
   DrawFunction(cmd);
 }
 
 void GPU_SW_Backend::DrawLine(const GPUBackendDrawLineCommand* cmd)
 {
+  m_drawing_area_written = true;
+
   const GPU_SW_Rasterizer::DrawLineFunction DrawFunction = GPU_SW_Rasterizer::GetDrawLineFunction(
     cmd->rc.shading_enable, cmd->rc.transparency_enable, cmd->IsDitheringEnabled());
 
@@ -60,6 +69,8 @@ void GPU_SW_Backend::DrawLine(const GPUBackendDrawLineCommand* cmd)
 
 void GPU_SW_Backend::FillVRAM(u32 x, u32 y, u32 width, u32 height, u32 color, GPUBackendCommandParameters params)
 {
+  InvalidateVRAMRows(y, height);
+
   const u16 color16 = VRAMRGBA8888ToRGBA5551(color);
   const GSVector4i fill = GSVector4i(color16, color16, color16, color16, color16, color16, color16, color16);
   constexpr u32 vector_width = 8;
@@ -135,6 +146,8 @@ void GPU_SW_Backend::FillVRAM(u32 x, u32 y, u32 width, u32 height, u32 color, GP
 void GPU_SW_Backend::UpdateVRAM(u32 x, u32 y, u32 width, u32 height, const void* data,
                                 GPUBackendCommandParameters params)
 {
+  InvalidateVRAMRows(y, height);
+
   // Fast path when the copy is not oversized.
   if ((x + width) <= VRAM_WIDTH && (y + height) <= VRAM_HEIGHT && !params.IsMaskingEnabled())
   {
@@ -171,6 +184,8 @@ void GPU_SW_Backend::UpdateVRAM(u32 x, u32 y, u32 width, u32 height, const void*
 void GPU_SW_Backend::CopyVRAM(u32 src_x, u32 src_y, u32 dst_x, u32 dst_y, u32 width, u32 height,
                               GPUBackendCommandParameters params)
 {
+  InvalidateVRAMRows(dst_y, height);
+
   // Break up oversized copies. This behavior has not been verified on console.
   if ((src_x + width) > VRAM_WIDTH || (dst_x + width) > VRAM_WIDTH)
   {
@@ -244,11 +259,92 @@ void GPU_SW_Backend::CopyVRAM(u32 src_x, u32 src_y, u32 dst_x, u32 dst_y, u32 wi
 
 void GPU_SW_Backend::UpdateCLUT(GPUTexturePaletteReg reg, bool clut_is_8bit)
 {
-  GPU::ReadCLUT(g_gpu_clut, reg, clut_is_8bit);
+  const u32 row = reg.GetYBase();
+  if (m_drawing_area_written && row >= GPU_SW_Rasterizer::g_drawing_area.top &&
+      row <= GPU_SW_Rasterizer::g_drawing_area.bottom)
+  {
+    FlushDrawingAreaWrites();
+  }
+
+  // An 8-bit palette also covers the 4-bit palette at the same address.
+  const u32 row_version = m_vram_row_versions[row];
+  CLUTCacheEntry* replace = &m_clut_cache[0];
+  for (CLUTCacheEntry& entry : m_clut_cache)
+  {
+    if (entry.valid && entry.reg_bits == reg.bits)
+    {
+      if (entry.row_version == row_version && (entry.is_8bit || !clut_is_8bit))
+      {
+        entry.last_used = ++m_clut_cache_counter;
+        GPU_SW_Rasterizer::g_clut = entry.data.data();
+        return;
+      }
+
+      replace = &entry;
+      break;
+    }
+
+    if (!entry.valid || (replace->valid && entry.last_used < replace->last_used))
+      replace = &entry;
+  }
+
+  GPU::ReadCLUT(replace->data.data(), reg, clut_is_8bit);
+  replace->reg_bits = reg.bits;
+  replace->is_8bit = clut_is_8bit;
+  replace->valid = true;
+  replace->row_version = row_version;
+  replace->last_used = ++m_clut_cache_counter;
+  GPU_SW_Rasterizer::g_clut = replace->data.data();
+}
+
+void GPU_SW_Backend::PreDoState(bool is_reading)
+{
+  Sync(true);
+  if (!is_reading)
+    WriteCLUTForState();
+}
+
+void GPU_SW_Backend::PostDoState(bool is_reading)
+{
+  if (is_reading)
+    InvalidateCLUTCache();
+}
+
+void GPU_SW_Backend::WriteCLUTForState()
+{
+  if (GPU_SW_Rasterizer::g_clut != g_gpu_clut)
+    std::memcpy(g_gpu_clut, GPU_SW_Rasterizer::g_clut, sizeof(g_gpu_clut));
+}
+
+void GPU_SW_Backend::InvalidateCLUTCache()
+{
+  for (CLUTCacheEntry& entry : m_clut_cache)
+    entry.valid = false;
+
+  GPU_SW_Rasterizer::g_clut = g_gpu_clut;
+}
+
+void GPU_SW_Backend::InvalidateVRAMRows(u32 y, u32 height)
+{
+  const u32 count = std::min<u32>(height, VRAM_HEIGHT);
+  for (u32 i = 0; i < count; i++)
+    m_vram_row_versions[(y + i) % VRAM_HEIGHT]++;
+}
+
+void GPU_SW_Backend::FlushDrawingAreaWrites()
+{
+  const GPUDrawingArea& area = GPU_SW_Rasterizer::g_drawing_area;
+  if (area.bottom >= area.top)
+    InvalidateVRAMRows(area.top, area.bottom - area.top + 1);
+
+  m_drawing_area_written = false;
 }
 
 void GPU_SW_Backend::DrawingAreaChanged(const GPUDrawingArea& new_drawing_area, const GSVector4i clamped_drawing_area)
 {
+  if (m_drawing_area_written)
+    FlushDrawingAreaWrites();
+
   GPU_SW_Rasterizer::g_drawing_area = new_drawing_area;
 }
 
@@ -17,6 +17,13 @@ public:
   bool Initialize(bool force_thread) override;
   void Reset() override;
 
+  /// Waits for pending commands, and when saving, copies the current palette to g_gpu_clut so it gets written.
+  /// Must be called before GPU::DoState().
+  void PreDoState(bool is_reading);
+
+  /// Drops all cached palettes after VRAM has been replaced by loading state. Must be called after GPU::DoState().
+  void PostDoState(bool is_reading);
+
 protected:
   void FillVRAM(u32 x, u32 y, u32 width, u32 height, u32 color, GPUBackendCommandParameters params) override;
   void UpdateVRAM(u32 x, u32 y, u32 width, u32 height, const void* data, GPUBackendCommandParameters params) override;
@@ -29,4 +36,32 @@ protected:
   void DrawingAreaChanged(const GPUDrawingArea& new_drawing_area, const GSVector4i clamped_drawing_area) override;
   void UpdateCLUT(GPUTexturePaletteReg reg, bool clut_is_8bit) override;
   void FlushRender() override;
+
+private:
+  static constexpr u32 CLUT_CACHE_SIZE = 16;
+
+  struct CLUTCacheEntry
+  {
+    u16 reg_bits;
+    bool is_8bit;
+    bool valid;
+    u32 row_version;
+    u32 last_used;
+    std::array<u16, GPU_CLUT_SIZE> data;
+  };
+
+  void WriteCLUTForState();
+  void InvalidateCLUTCache();
+  void InvalidateVRAMRows(u32 y, u32 height);
+  void FlushDrawingAreaWrites();
+
+  // Palettes are reloaded whenever the game switches between them, which is often several times per frame in 2D
+  // games. Keep the recent ones around, and only re-read VRAM when the row they live in has been written.
+  std::array<CLUTCacheEntry, CLUT_CACHE_SIZE> m_clut_cache = {};
+  std::array<u32, VRAM_HEIGHT> m_vram_row_versions = {};
+  u32 m_clut_cache_counter = 0;
+
+  // Draws are clipped to the drawing area, so rather than tracking each draw, the rows of the whole area are
+  // invalidated at once if anything was drawn there.
+  bool m_drawing_area_written = false;
 };
@@ -0,0 +1,287 @@
+// SPDX-FileCopyrightText: 2019-2024 Connor McLaughlin <stenzek@gmail.com>
+// SPDX-License-Identifier: (GPL-3.0 OR CC-BY-NC-ND-4.0)
+
+#pragma once
+
+#include "util/gpu_texture.h"
+
+#include "common/align.h"
+#include "common/bitutils.h"
+#include "common/gsvector.h"
+#include "common/types.h"
+
+// Display copy-out kernels for the software renderer, converting one row of VRAM to the display texture format.
+// Kept in a header so that common-tests can check the vector loops against the scalar conversions.
+
+template<GPUTexture::Format out_format, typename out_type>
+static void CopyOutRow16(const u16* src_ptr, out_type* dst_ptr, u32 width);
+
+template<GPUTexture::Format out_format, typename out_type>
+static out_type VRAM16ToOutput(u16 value);
+
+template<>
+ALWAYS_INLINE u16 VRAM16ToOutput<GPUTexture::Format::RGBA5551, u16>(u16 value)
+{
+  return (value & 0x3E0) | ((value >> 10) & 0x1F) | ((value & 0x1F) << 10);
+}
+
+template<>
+ALWAYS_INLINE u16 VRAM16ToOutput<GPUTexture::Format::RGB565, u16>(u16 value)
+{
+  return ((value & 0x3E0) << 1) | ((value & 0x20) << 1) | ((value >> 10) & 0x1F) | ((value & 0x1F) << 11);
+}
+
+template<>
+ALWAYS_INLINE u32 VRAM16ToOutput<GPUTexture::Format::RGBA8, u32>(u16 value)
+{
+  const u32 value32 = ZeroExtend32(value);
+  const u32 r = (value32 & 31u) << 3;
+  const u32 g = ((value32 >> 5) & 31u) << 3;
+  const u32 b = ((value32 >> 10) & 31u) << 3;
+  const u32 a = ((value >> 15) != 0) ? 255 : 0;
+  return ZeroExtend32(r) | (ZeroExtend32(g) << 8) | (ZeroExtend32(b) << 16) | (ZeroExtend32(a) << 24);
+}
+
+template<>
+ALWAYS_INLINE u32 VRAM16ToOutput<GPUTexture::Format::BGRA8, u32>(u16 value)
+{
+  const u32 value32 = ZeroExtend32(value);
+  const u32 r = (value32 & 31u) << 3;
+  const u32 g = ((value32 >> 5) & 31u) << 3;
+  const u32 b = ((value32 >> 10) & 31u) << 3;
+  return ZeroExtend32(b) | (ZeroExtend32(g) << 8) | (ZeroExtend32(r) << 16) | (0xFF000000u);
+}
+
+template<>
+ALWAYS_INLINE void CopyOutRow16<GPUTexture::Format::RGBA5551, u16>(const u16* src_ptr, u16* dst_ptr, u32 width)
+{
+  u32 col = 0;
+
+  const u32 aligned_width = Common::AlignDownPow2(width, 8);
+  for (; col < aligned_width; col += 8)
+  {
+    constexpr GSVector4i single_mask = GSVector4i::cxpr16(0x1F);
+    GSVector4i value = GSVector4i::load<false>(src_ptr);
+    src_ptr += 8;
+    GSVector4i a = value & GSVector4i::cxpr16(0x3E0);
+    GSVector4i b = value.srl16<10>() & single_mask;
+    GSVector4i c = (value & single_mask).sll16<10>();
+    value = (a | b) | c;
+    GSVector4i::store<false>(dst_ptr, value);
+    dst_ptr += 8;
+  }
+
+  for (; col < width; col++)
+    *(dst_ptr++) = VRAM16ToOutput<GPUTexture::Format::RGBA5551, u16>(*(src_ptr++));
+}
+
+template<>
+ALWAYS_INLINE void CopyOutRow16<GPUTexture::Format::RGB565, u16>(const u16* src_ptr, u16* dst_ptr, u32 width)
+{
+  u32 col = 0;
+
+  const u32 aligned_width = Common::AlignDownPow2(width, 8);
+  for (; col < aligned_width; col += 8)
+  {
+    constexpr GSVector4i single_mask = GSVector4i::cxpr16(0x1F);
+    GSVector4i value = GSVector4i::load<false>(src_ptr);
+    src_ptr += 8;
+    GSVector4i a = (value & GSVector4i::cxpr16(0x3E0)).sll16<1>(); // (value & 0x3E0) << 1
+    GSVector4i b = (value & GSVector4i::cxpr16(0x20)).sll16<1>();  // (value & 0x20) << 1
+    GSVector4i c = (value.srl16<10>() & single_mask);              // ((value >> 10) & 0x1F)
+    GSVector4i d = (value & single_mask).sll16<11>();              // ((value & 0x1F) << 11)
+    value = (((a | b) | c) | d);
+    GSVector4i::store<false>(dst_ptr, value);
+    dst_ptr += 8;
+  }
+
+  for (; col < width; col++)
+    *(dst_ptr++) = VRAM16ToOutput<GPUTexture::Format::RGB565, u16>(*(src_ptr++));
+}
+
+template<>
+ALWAYS_INLINE void CopyOutRow16<GPUTexture::Format::RGBA8, u32>(const u16* src_ptr, u32* dst_ptr, u32 width)
+{
+  u32 col = 0;
+
+  const u32 aligned_width = Common::AlignDownPow2(width, 8);
+  for (; col < aligned_width; col += 8)
+  {
+    constexpr GSVector4i single_mask = GSVector4i::cxpr16(0x1F);
+    const GSVector4i value = GSVector4i::load<false>(src_ptr);
+    src_ptr += 8;
+    const GSVector4i r = (value & single_mask).sll16<3>();             // (value & 0x1F) << 3
+    const GSVector4i g = (value.srl16<5>() & single_mask).sll16<11>(); // (((value >> 5) & 0x1F) << 3) << 8
+    const GSVector4i b = (value.srl16<10>() & single_mask).sll16<3>(); // ((value >> 10) & 0x1F) << 3
+    const GSVector4i a = value.sra16<15>().sll16<8>();                 // (value & 0x8000) ? 0xFF00 : 0
+    const GSVector4i rg = r | g;
+    const GSVector4i ba = b | a;
+    GSVector4i::store<false>(dst_ptr, rg.upl16(ba));
+    GSVector4i::store<false>(dst_ptr + 4, rg.uph16(ba));
+    dst_ptr += 8;
+  }
+
+  for (; col < width; col++)
+    *(dst_ptr++) = VRAM16ToOutput<GPUTexture::Format::RGBA8, u32>(*(src_ptr++));
+}
+
+template<>
+ALWAYS_INLINE void CopyOutRow16<GPUTexture::Format::BGRA8, u32>(const u16* src_ptr, u32* dst_ptr, u32 width)
+{
+  u32 col = 0;
+
+  const u32 aligned_width = Common::AlignDownPow2(width, 8);
+  for (; col < aligned_width; col += 8)
+  {
+    constexpr GSVector4i single_mask = GSVector4i::cxpr16(0x1F);
+    const GSVector4i value = GSVector4i::load<false>(src_ptr);
+    src_ptr += 8;
+    const GSVector4i b = (value.srl16<10>() & single_mask).sll16<3>(); // ((value >> 10) & 0x1F) << 3
+    const GSVector4i g = (value.srl16<5>() & single_mask).sll16<11>(); // (((value >> 5) & 0x1F) << 3) << 8
+    const GSVector4i r = (value & single_mask).sll16<3>();             // (value & 0x1F) << 3
+    const GSVector4i bg = b | g;
+    const GSVector4i ra = r | GSVector4i::cxpr16(static_cast<s16>(0xFF00));
+    GSVector4i::store<false>(dst_ptr, bg.upl16(ra));
+    GSVector4i::store<false>(dst_ptr + 4, bg.uph16(ra));
+    dst_ptr += 8;
+  }
+
+  for (; col < width; col++)
+    *(dst_ptr++) = VRAM16ToOutput<GPUTexture::Format::BGRA8, u32>(*(src_ptr++));
+}
+
+template<GPUTexture::Format out_format, typename out_type>
+static void CopyOutRow24(const u8* src_ptr, out_type* dst_ptr, u32 width);
+
+template<GPUTexture::Format out_format, typename out_type>
+static out_type VRAM24ToOutput(const u8* src_ptr);
+
+template<>
+ALWAYS_INLINE u16 VRAM24ToOutput<GPUTexture::Format::RGBA5551, u16>(const u8* src_ptr)
+{
+  return ((static_cast<u16>(src_ptr[0]) >> 3) << 10) | ((static_cast<u16>(src_ptr[1]) >> 3) << 5) |
+         (static_cast<u16>(src_ptr[2]) >> 3);
+}
+
+template<>
+ALWAYS_INLINE u16 VRAM24ToOutput<GPUTexture::Format::RGB565, u16>(const u8* src_ptr)
+{
+  return ((static_cast<u16>(src_ptr[0]) >> 3) << 11) | ((static_cast<u16>(src_ptr[1]) >> 2) << 5) |
+         (static_cast<u16>(src_ptr[2]) >> 3);
+}
+
+template<>
+ALWAYS_INLINE u32 VRAM24ToOutput<GPUTexture::Format::RGBA8, u32>(const u8* src_ptr)
+{
+  return ZeroExtend32(src_ptr[0]) | (ZeroExtend32(src_ptr[1]) << 8) | (ZeroExtend32(src_ptr[2]) << 16) | 0xFF000000u;
+}
+
+template<>
+ALWAYS_INLINE u32 VRAM24ToOutput<GPUTexture::Format::BGRA8, u32>(const u8* src_ptr)
+{
+  return ZeroExtend32(src_ptr[2]) | (ZeroExtend32(src_ptr[1]) << 8) | (ZeroExtend32(src_ptr[0]) << 16) | 0xFF000000u;
+}
+
+// The vector loops load 16 bytes at a time but only consume 12 (four pixels), so they stop early enough that the
+// loads never go past the last pixel in the row. The remainder is handled by the scalar loop.
+template<>
+ALWAYS_INLINE void CopyOutRow24<GPUTexture::Format::RGBA5551, u16>(const u8* src_ptr, u16* dst_ptr, u32 width)
+{
+  u32 col = 0;
+
+  for (; (col + 10) <= width; col += 8)
+  {
+    constexpr GSVector4i shuffle_mask = GSVector4i::cxpr8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+    const GSVector4i lo = GSVector4i::load<false>(src_ptr).shuffle8(shuffle_mask);
+    const GSVector4i hi = GSVector4i::load<false>(src_ptr + 12).shuffle8(shuffle_mask);
+    src_ptr += 24;
+
+    // RGBX8 -> RGB5A1, with red in the upper bits.
+    const auto convert = [](const GSVector4i& v) {
+      const GSVector4i r = (v & GSVector4i::cxpr(0xF8)).sll32<7>(); // (R >> 3) << 10
+      const GSVector4i g = v.srl32<6>() & GSVector4i::cxpr(0x3E0);  // (G >> 3) << 5
+      const GSVector4i b = v.srl32<19>() & GSVector4i::cxpr(0x1F);  // (B >> 3)
+      return (r | g) | b;
+    };
+    GSVector4i::store<false>(dst_ptr, convert(lo).pu32(convert(hi)));
+    dst_ptr += 8;
+  }
+
+  for (; col < width; col++)
+  {
+    *(dst_ptr++) = VRAM24ToOutput<GPUTexture::Format::RGBA5551, u16>(src_ptr);
+    src_ptr += 3;
+  }
+}
+
+template<>
+ALWAYS_INLINE void CopyOutRow24<GPUTexture::Format::RGB565, u16>(const u8* src_ptr, u16* dst_ptr, u32 width)
+{
+  u32 col = 0;
+
+  for (; (col + 10) <= width; col += 8)
+  {
+    constexpr GSVector4i shuffle_mask = GSVector4i::cxpr8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+    const GSVector4i lo = GSVector4i::load<false>(src_ptr).shuffle8(shuffle_mask);
+    const GSVector4i hi = GSVector4i::load<false>(src_ptr + 12).shuffle8(shuffle_mask);
+    src_ptr += 24;
+
+    // RGBX8 -> RGB565, with red in the upper bits.
+    const auto convert = [](const GSVector4i& v) {
+      const GSVector4i r = (v & GSVector4i::cxpr(0xF8)).sll32<8>(); // (R >> 3) << 11
+      const GSVector4i g = v.srl32<5>() & GSVector4i::cxpr(0x7E0);  // (G >> 2) << 5
+      const GSVector4i b = v.srl32<19>() & GSVector4i::cxpr(0x1F);  // (B >> 3)
+      return (r | g) | b;
+    };
+    GSVector4i::store<false>(dst_ptr, convert(lo).pu32(convert(hi)));
+    dst_ptr += 8;
+  }
+
+  for (; col < width; col++)
+  {
+    *(dst_ptr++) = VRAM24ToOutput<GPUTexture::Format::RGB565, u16>(src_ptr);
+    src_ptr += 3;
+  }
+}
+
+template<>
+ALWAYS_INLINE void CopyOutRow24<GPUTexture::Format::RGBA8, u32>(const u8* src_ptr, u32* dst_ptr, u32 width)
+{
+  u32 col = 0;
+
+  for (; (col + 6) <= width; col += 4)
+  {
+    constexpr GSVector4i shuffle_mask = GSVector4i::cxpr8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+    const GSVector4i value = GSVector4i::load<false>(src_ptr).shuffle8(shuffle_mask);
+    src_ptr += 12;
+    GSVector4i::store<false>(dst_ptr, value | GSVector4i::cxpr(static_cast<s32>(0xFF000000u)));
+    dst_ptr += 4;
+  }
+
+  for (; col < width; col++)
+  {
+    *(dst_ptr++) = VRAM24ToOutput<GPUTexture::Format::RGBA8, u32>(src_ptr);
+    src_ptr += 3;
+  }
+}
+
+template<>
+ALWAYS_INLINE void CopyOutRow24<GPUTexture::Format::BGRA8, u32>(const u8* src_ptr, u32* dst_ptr, u32 width)
+{
+  u32 col = 0;
+
+  for (; (col + 6) <= width; col += 4)
+  {
+    constexpr GSVector4i shuffle_mask = GSVector4i::cxpr8(2, 1, 0, -1, 5, 4, 3, -1, 8, 7, 6, -1, 11, 10, 9, -1);
+    const GSVector4i value = GSVector4i::load<false>(src_ptr).shuffle8(shuffle_mask);
+    src_ptr += 12;
+    GSVector4i::store<false>(dst_ptr, value | GSVector4i::cxpr(static_cast<s32>(0xFF000000u)));
+    dst_ptr += 4;
+  }
+
+  for (; col < width; col++)
+  {
+    *(dst_ptr++) = VRAM24ToOutput<GPUTexture::Format::BGRA8, u32>(src_ptr);
+    src_ptr += 3;
+  }
+}
@@ -34,6 +34,7 @@ constinit const DitherLUT g_dither_lut = []() constexpr {
 }();
 
 GPUDrawingArea g_drawing_area = {};
+const u16* g_clut = g_gpu_clut;
 } // namespace GPU_SW_Rasterizer
 
 // Default implementation definitions.
@@ -21,14 +21,17 @@ extern const DitherLUT g_dither_lut;
 
 extern GPUDrawingArea g_drawing_area;
 
+// Palette for the current draw. Points into the backend's CLUT cache, or g_gpu_clut after loading state.
+extern const u16* g_clut;
+
 using DrawRectangleFunction = void (*)(const GPUBackendDrawRectangleCommand* cmd);
-typedef const DrawRectangleFunction DrawRectangleFunctionTable[2][2][2];
+typedef const DrawRectangleFunction DrawRectangleFunctionTable[2][2][2][2];
 
 using DrawTriangleFunction = void (*)(const GPUBackendDrawPolygonCommand* cmd,
                                       const GPUBackendDrawPolygonCommand::Vertex* v0,
                                       const GPUBackendDrawPolygonCommand::Vertex* v1,
                                       const GPUBackendDrawPolygonCommand::Vertex* v2);
-typedef const DrawTriangleFunction DrawTriangleFunctionTable[2][2][2][2][2];
+typedef const DrawTriangleFunction DrawTriangleFunctionTable[2][2][2][2][2][2];
 
 using DrawLineFunction = void (*)(const GPUBackendDrawLineCommand* cmd, const GPUBackendDrawLineCommand::Vertex* p0,
                                   const GPUBackendDrawLineCommand::Vertex* p1);
@@ -53,17 +56,25 @@ ALWAYS_INLINE static DrawLineFunction GetDrawLineFunction(bool shading_enable, b
 }
 
 ALWAYS_INLINE static DrawRectangleFunction GetDrawRectangleFunction(bool texture_enable, bool raw_texture_enable,
-                                                                    bool transparency_enable)
+                                                                    bool transparency_enable,
+                                                                    bool texture_window_enable)
 {
-  return (*SelectedDrawRectangleFunctions)[u8(texture_enable)][u8(raw_texture_enable)][u8(transparency_enable)];
+  return (*SelectedDrawRectangleFunctions)[u8(texture_enable)][u8(raw_texture_enable)][u8(transparency_enable)]
+                                          [u8(texture_window_enable)];
 }
 
 ALWAYS_INLINE static DrawTriangleFunction GetDrawTriangleFunction(bool shading_enable, bool texture_enable,
                                                                   bool raw_texture_enable, bool transparency_enable,
-                                                                  bool dithering_enable)
+                                                                  bool dithering_enable, bool texture_window_enable)
 {
   return (*SelectedDrawTriangleFunctions)[u8(shading_enable)][u8(texture_enable)][u8(raw_texture_enable)]
-                                         [u8(transparency_enable)][u8(dithering_enable)];
+                                         [u8(transparency_enable)][u8(dithering_enable)][u8(texture_window_enable)];
+}
+
+/// Returns true if the texture window changes texture coordinates, otherwise the masking can be skipped.
+ALWAYS_INLINE static bool IsTextureWindowActive(const GPUTextureWindow& window)
+{
+  return ((window.and_x & window.and_y) != 0xFF || (window.or_x | window.or_y) != 0);
 }
 
 #define DECLARE_ALTERNATIVE_RASTERIZER(isa)                                                                            \
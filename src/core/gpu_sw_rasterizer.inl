@@ -75,7 +75,8 @@ static u16 s_new_vram[VRAM_WIDTH * VRAM_HEIGHT];
   return std::make_tuple(static_cast<u8>(rgb24), static_cast<u8>(rgb24 >> 8), static_cast<u8>(rgb24 >> 16));
 }
 
-template<bool texture_enable, bool raw_texture_enable, bool transparency_enable, bool dithering_enable>
+template<bool texture_enable, bool raw_texture_enable, bool transparency_enable, bool dithering_enable,
+         bool texture_window_enable>
 [[maybe_unused]] ALWAYS_INLINE_RELEASE static void ShadePixel(const GPUBackendDrawCommand* cmd, u32 x, u32 y,
                                                               u8 color_r, u8 color_g, u8 color_b, u8 texcoord_x,
                                                               u8 texcoord_y)
@@ -83,9 +84,12 @@ template<bool texture_enable, bool raw_texture_enable, bool transparency_enable,
   u16 color;
   if constexpr (texture_enable)
   {
-    // Apply texture window
-    texcoord_x = (texcoord_x & cmd->window.and_x) | cmd->window.or_x;
-    texcoord_y = (texcoord_y & cmd->window.and_y) | cmd->window.or_y;
+    // Apply texture window, most draws don't use one.
+    if constexpr (texture_window_enable)
+    {
+      texcoord_x = (texcoord_x & cmd->window.and_x) | cmd->window.or_x;
+      texcoord_y = (texcoord_y & cmd->window.and_y) | cmd->window.or_y;
+    }
 
     u16 texture_color;
     switch (cmd->draw_mode.texture_mode)
@@ -96,7 +100,7 @@ template<bool texture_enable, bool raw_texture_enable, bool transparency_enable,
           GetPixel((cmd->draw_mode.GetTexturePageBaseX() + ZeroExtend32(texcoord_x / 4)) % VRAM_WIDTH,
                    (cmd->draw_mode.GetTexturePageBaseY() + ZeroExtend32(texcoord_y)) % VRAM_HEIGHT);
         const size_t palette_index = (palette_value >> ((texcoord_x % 4) * 4)) & 0x0Fu;
-        texture_color = g_gpu_clut[palette_index];
+        texture_color = g_clut[palette_index];
       }
       break;
 
@@ -106,7 +110,7 @@ template<bool texture_enable, bool raw_texture_enable, bool transparency_enable,
           GetPixel((cmd->draw_mode.GetTexturePageBaseX() + ZeroExtend32(texcoord_x / 2)) % VRAM_WIDTH,
                    (cmd->draw_mode.GetTexturePageBaseY() + ZeroExtend32(texcoord_y)) % VRAM_HEIGHT);
         const size_t palette_index = (palette_value >> ((texcoord_x % 2) * 8)) & 0xFFu;
-        texture_color = g_gpu_clut[palette_index];
+        texture_color = g_clut[palette_index];
       }
       break;
 
@@ -221,7 +225,7 @@ template<bool texture_enable, bool raw_texture_enable, bool transparency_enable,
 
 #ifndef USE_VECTOR
 
-template<bool texture_enable, bool raw_texture_enable, bool transparency_enable>
+template<bool texture_enable, bool raw_texture_enable, bool transparency_enable, bool texture_window_enable>
 static void DrawRectangle(const GPUBackendDrawRectangleCommand* cmd)
 {
   const s32 origin_x = cmd->x;
@@ -249,8 +253,8 @@ static void DrawRectangle(const GPUBackendDrawRectangleCommand* cmd)
 
       const u8 texcoord_x = Truncate8(ZeroExtend32(origin_texcoord_x) + offset_x);
 
-      ShadePixel<texture_enable, raw_texture_enable, transparency_enable, false>(cmd, static_cast<u32>(x), draw_y, r, g,
-                                                                                 b, texcoord_x, texcoord_y);
+      ShadePixel<texture_enable, raw_texture_enable, transparency_enable, false, texture_window_enable>(
+        cmd, static_cast<u32>(x), draw_y, r, g, b, texcoord_x, texcoord_y);
     }
   }
 }
@@ -291,10 +295,10 @@ ALWAYS_INLINE_RELEASE static GSVector4i GatherCLUTVector(GSVector4i indices)
 
   // TODO: split in two, merge, maybe could be zx loaded instead..
   u16 p0, p1, p2, p3;
-  std::memcpy(&p0, reinterpret_cast<const u8*>(g_gpu_clut) + o0, sizeof(p0));
-  std::memcpy(&p1, reinterpret_cast<const u8*>(g_gpu_clut) + o1, sizeof(p1));
-  std::memcpy(&p2, reinterpret_cast<const u8*>(g_gpu_clut) + o2, sizeof(p2));
-  std::memcpy(&p3, reinterpret_cast<const u8*>(g_gpu_clut) + o3, sizeof(p3));
+  std::memcpy(&p0, reinterpret_cast<const u8*>(g_clut) + o0, sizeof(p0));
+  std::memcpy(&p1, reinterpret_cast<const u8*>(g_clut) + o1, sizeof(p1));
+  std::memcpy(&p2, reinterpret_cast<const u8*>(g_clut) + o2, sizeof(p2));
+  std::memcpy(&p3, reinterpret_cast<const u8*>(g_clut) + o3, sizeof(p3));
   GSVector4i pixels = GSVector4i::load(p0);
   pixels = pixels.insert16<2>(p1);
   pixels = pixels.insert16<4>(p2);
@@ -367,7 +371,8 @@ static constexpr s16 VECTOR_DITHER_MATRIX[4][16] = {
 #undef P
 };
 
-template<bool texture_enable, bool raw_texture_enable, bool transparency_enable, bool dithering_enable>
+template<bool texture_enable, bool raw_texture_enable, bool transparency_enable, bool dithering_enable,
+         bool texture_window_enable>
 ALWAYS_INLINE_RELEASE static void
 ShadePixel(const GPUBackendDrawCommand* cmd, u32 start_x, u32 y, GSVector4i vertex_color_rg, GSVector4i vertex_color_ba,
            GSVector4i texcoord_x, GSVector4i texcoord_y, GSVector4i preserve_mask, GSVector4i dither)
@@ -379,9 +384,12 @@ ShadePixel(const GPUBackendDrawCommand* cmd, u32 start_x, u32 y, GSVector4i vert
 
   if constexpr (texture_enable)
   {
-    // Apply texture window
-    texcoord_x = (texcoord_x & GSVector4i(cmd->window.and_x)) | GSVector4i(cmd->window.or_x);
-    texcoord_y = (texcoord_y & GSVector4i(cmd->window.and_y)) | GSVector4i(cmd->window.or_y);
+    // Apply texture window, most draws don't use one.
+    if constexpr (texture_window_enable)
+    {
+      texcoord_x = (texcoord_x & GSVector4i(cmd->window.and_x)) | GSVector4i(cmd->window.or_x);
+      texcoord_y = (texcoord_y & GSVector4i(cmd->window.and_y)) | GSVector4i(cmd->window.or_y);
+    }
 
     const GSVector4i base_x = GSVector4i(cmd->draw_mode.GetTexturePageBaseX());
     const GSVector4i base_y = GSVector4i(cmd->draw_mode.GetTexturePageBaseY());
@@ -594,7 +602,7 @@ ShadePixel(const GPUBackendDrawCommand* cmd, u32 start_x, u32 y, GSVector4i vert
   StoreVector(start_x, y, packed_color);
 }
 
-template<bool texture_enable, bool raw_texture_enable, bool transparency_enable>
+template<bool texture_enable, bool raw_texture_enable, bool transparency_enable, bool texture_window_enable>
 static void DrawRectangle(const GPUBackendDrawRectangleCommand* cmd)
 {
   const s32 origin_x = cmd->x;
@@ -640,7 +648,7 @@ static void DrawRectangle(const GPUBackendDrawRectangleCommand* cmd)
       preserve_mask = preserve_mask | xvec.gt32(clip_right);
       if (!preserve_mask.alltrue())
       {
-        ShadePixel<texture_enable, raw_texture_enable, transparency_enable, false>(
+        ShadePixel<texture_enable, raw_texture_enable, transparency_enable, false, texture_window_enable>(
           cmd, x, y, rg, ba, row_texcoord_x, texcoord_y, preserve_mask, GSVector4i::zero());
       }
 
@@ -655,7 +663,8 @@ static void DrawRectangle(const GPUBackendDrawRectangleCommand* cmd)
       texcoord_y = texcoord_y.add32(GSVector4i::cxpr(1)) & GSVector4i::cxpr(0xFF);
   }
 
-  CHECK_VRAM(GPU_SW_Rasterizer::DrawRectangleFunctions[texture_enable][raw_texture_enable][transparency_enable](cmd));
+  CHECK_VRAM(GPU_SW_Rasterizer::DrawRectangleFunctions[texture_enable][raw_texture_enable][transparency_enable]
+                                                      [texture_window_enable](cmd));
 }
 
 #endif // USE_VECTOR
@@ -724,7 +733,7 @@ static void DrawLine(const GPUBackendDrawLineCommand* cmd, const GPUBackendDrawL
       const u8 g = shading_enable ? unfp_rgb(curg) : p0->g;
       const u8 b = shading_enable ? unfp_rgb(curb) : p0->b;
 
-      ShadePixel<false, false, transparency_enable, dithering_enable>(
+      ShadePixel<false, false, transparency_enable, dithering_enable, false>(
         cmd, static_cast<u32>(x), static_cast<u32>(y) & VRAM_HEIGHT_MASK, r, g, b, 0, 0);
     }
 
@@ -837,7 +846,7 @@ struct TrianglePart
 #ifndef USE_VECTOR
 
 template<bool shading_enable, bool texture_enable, bool raw_texture_enable, bool transparency_enable,
-         bool dithering_enable>
+         bool dithering_enable, bool texture_window_enable>
 static void DrawSpan(const GPUBackendDrawPolygonCommand* cmd, s32 y, s32 x_start, s32 x_bound, UVStepper uv,
                      const UVSteps& uvstep, RGBStepper rgb, const RGBSteps& rgbstep)
 {
@@ -869,7 +878,7 @@ static void DrawSpan(const GPUBackendDrawPolygonCommand* cmd, s32 y, s32 x_start
 
   do
   {
-    ShadePixel<texture_enable, raw_texture_enable, transparency_enable, dithering_enable>(
+    ShadePixel<texture_enable, raw_texture_enable, transparency_enable, dithering_enable, texture_window_enable>(
       cmd, static_cast<u32>(current_x), static_cast<u32>(y), rgb.GetR(), rgb.GetG(), rgb.GetB(), uv.GetU(), uv.GetV());
 
     current_x++;
@@ -883,7 +892,7 @@ static void DrawSpan(const GPUBackendDrawPolygonCommand* cmd, s32 y, s32 x_start
 #else // USE_VECTOR
 
 template<bool shading_enable, bool texture_enable, bool raw_texture_enable, bool transparency_enable,
-         bool dithering_enable>
+         bool dithering_enable, bool texture_window_enable>
 static void DrawSpan(const GPUBackendDrawPolygonCommand* cmd, s32 y, s32 x_start, s32 x_bound, UVStepper uv,
                      const UVSteps& uvstep, RGBStepper rgb, const RGBSteps& rgbstep)
 {
@@ -985,7 +994,7 @@ static void DrawSpan(const GPUBackendDrawPolygonCommand* cmd, s32 y, s32 x_start
     preserve_mask = preserve_mask | xvec.gt32(clip_right);
     if (!preserve_mask.alltrue())
     {
-      ShadePixel<texture_enable, raw_texture_enable, transparency_enable, dithering_enable>(
+      ShadePixel<texture_enable, raw_texture_enable, transparency_enable, dithering_enable, texture_window_enable>(
         cmd, static_cast<u32>(x), static_cast<u32>(y), rg, b, u, v, preserve_mask, dither);
     }
 
@@ -1012,7 +1021,7 @@ static void DrawSpan(const GPUBackendDrawPolygonCommand* cmd, s32 y, s32 x_start
 #endif // USE_VECTOR
 
 template<bool shading_enable, bool texture_enable, bool raw_texture_enable, bool transparency_enable,
-         bool dithering_enable>
+         bool dithering_enable, bool texture_window_enable>
 ALWAYS_INLINE_RELEASE static void DrawTrianglePart(const GPUBackendDrawPolygonCommand* cmd, const TrianglePart& tp,
                                                    const UVStepper& uv, const UVSteps& uvstep, const RGBStepper& rgb,
                                                    const RGBSteps& rgbstep)
@@ -1040,7 +1049,8 @@ ALWAYS_INLINE_RELEASE static void DrawTrianglePart(const GPUBackendDrawPolygonCo
       else if (y > static_cast<s32>(g_drawing_area.bottom))
         continue;
 
-      DrawSpan<shading_enable, texture_enable, raw_texture_enable, transparency_enable, dithering_enable>(
+      DrawSpan<shading_enable, texture_enable, raw_texture_enable, transparency_enable, dithering_enable,
+               texture_window_enable>(
         cmd, y & VRAM_HEIGHT_MASK, unfp_xy(left_x), unfp_xy(right_x), uv, uvstep, rgb, rgbstep);
     }
   }
@@ -1056,7 +1066,8 @@ ALWAYS_INLINE_RELEASE static void DrawTrianglePart(const GPUBackendDrawPolygonCo
       }
       else if (y >= static_cast<s32>(g_drawing_area.top))
       {
-        DrawSpan<shading_enable, texture_enable, raw_texture_enable, transparency_enable, dithering_enable>(
+        DrawSpan<shading_enable, texture_enable, raw_texture_enable, transparency_enable, dithering_enable,
+               texture_window_enable>(
           cmd, y & VRAM_HEIGHT_MASK, unfp_xy(left_x), unfp_xy(right_x), uv, uvstep, rgb, rgbstep);
       }
 
@@ -1068,7 +1079,7 @@ ALWAYS_INLINE_RELEASE static void DrawTrianglePart(const GPUBackendDrawPolygonCo
 }
 
 template<bool shading_enable, bool texture_enable, bool raw_texture_enable, bool transparency_enable,
-         bool dithering_enable>
+         bool dithering_enable, bool texture_window_enable>
 static void DrawTriangle(const GPUBackendDrawPolygonCommand* cmd, const GPUBackendDrawPolygonCommand::Vertex* v0,
                          const GPUBackendDrawPolygonCommand::Vertex* v1, const GPUBackendDrawPolygonCommand::Vertex* v2)
 {
@@ -1204,22 +1215,26 @@ static void DrawTriangle(const GPUBackendDrawPolygonCommand* cmd, const GPUBacke
 
   for (u32 i = 0; i < 2; i++)
   {
-    DrawTrianglePart<shading_enable, texture_enable, raw_texture_enable, transparency_enable, dithering_enable>(
-      cmd, triparts[i], uv, uvstep, rgb, rgbstep);
+    DrawTrianglePart<shading_enable, texture_enable, raw_texture_enable, transparency_enable, dithering_enable,
+                     texture_window_enable>(cmd, triparts[i], uv, uvstep, rgb, rgbstep);
   }
 
 #ifdef USE_VECTOR
   CHECK_VRAM(
     GPU_SW_Rasterizer::DrawTriangleFunctions[shading_enable][texture_enable][raw_texture_enable][transparency_enable]
-                                            [dithering_enable](cmd, orig_v0, orig_v1, orig_v2));
+                                            [dithering_enable][texture_window_enable](cmd, orig_v0, orig_v1, orig_v2));
 #endif
 }
 
 constinit const DrawRectangleFunctionTable DrawRectangleFunctions = {
-  {{&DrawRectangle<false, false, false>, &DrawRectangle<false, false, true>},
-   {&DrawRectangle<false, false, false>, &DrawRectangle<false, false, true>}},
-  {{&DrawRectangle<true, false, false>, &DrawRectangle<true, false, true>},
-   {&DrawRectangle<true, true, false>, &DrawRectangle<true, true, true>}}};
+  {{{&DrawRectangle<false, false, false, false>, &DrawRectangle<false, false, false, false>},
+     {&DrawRectangle<false, false, true, false>, &DrawRectangle<false, false, true, false>}},
+    {{&DrawRectangle<false, false, false, false>, &DrawRectangle<false, false, false, false>},
+     {&DrawRectangle<false, false, true, false>, &DrawRectangle<false, false, true, false>}}},
+  {{{&DrawRectangle<true, false, false, false>, &DrawRectangle<true, false, false, true>},
+     {&DrawRectangle<true, false, true, false>, &DrawRectangle<true, false, true, true>}},
+    {{&DrawRectangle<true, true, false, false>, &DrawRectangle<true, true, false, true>},
+     {&DrawRectangle<true, true, true, false>, &DrawRectangle<true, true, true, true>}}}};
 
 constinit const DrawLineFunctionTable DrawLineFunctions = {
   {{&DrawLine<false, false, false>, &DrawLine<false, false, true>},
@@ -1228,22 +1243,70 @@ constinit const DrawLineFunctionTable DrawLineFunctions = {
    {&DrawLine<true, true, false>, &DrawLine<true, true, true>}}};
 
 constinit const DrawTriangleFunctionTable DrawTriangleFunctions = {
-  {{{{&DrawTriangle<false, false, false, false, false>, &DrawTriangle<false, false, false, false, true>},
-     {&DrawTriangle<false, false, false, true, false>, &DrawTriangle<false, false, false, true, true>}},
-    {{&DrawTriangle<false, false, false, false, false>, &DrawTriangle<false, false, false, false, false>},
-     {&DrawTriangle<false, false, false, true, false>, &DrawTriangle<false, false, false, true, false>}}},
-   {{{&DrawTriangle<false, true, false, false, false>, &DrawTriangle<false, true, false, false, true>},
-     {&DrawTriangle<false, true, false, true, false>, &DrawTriangle<false, true, false, true, true>}},
-    {{&DrawTriangle<false, true, true, false, false>, &DrawTriangle<false, true, true, false, false>},
-     {&DrawTriangle<false, true, true, true, false>, &DrawTriangle<false, true, true, true, false>}}}},
-  {{{{&DrawTriangle<true, false, false, false, false>, &DrawTriangle<true, false, false, false, true>},
-     {&DrawTriangle<true, false, false, true, false>, &DrawTriangle<true, false, false, true, true>}},
-    {{&DrawTriangle<true, false, false, false, false>, &DrawTriangle<true, false, false, false, false>},
-     {&DrawTriangle<true, false, false, true, false>, &DrawTriangle<true, false, false, true, false>}}},
-   {{{&DrawTriangle<true, true, false, false, false>, &DrawTriangle<true, true, false, false, true>},
-     {&DrawTriangle<true, true, false, true, false>, &DrawTriangle<true, true, false, true, true>}},
-    {{&DrawTriangle<true, true, true, false, false>, &DrawTriangle<true, true, true, false, false>},
-     {&DrawTriangle<true, true, true, true, false>, &DrawTriangle<true, true, true, true, false>}}}}};
+  {{{{{&DrawTriangle<false, false, false, false, false, false>,
+        &DrawTriangle<false, false, false, false, false, false>},
+       {&DrawTriangle<false, false, false, false, true, false>,
+        &DrawTriangle<false, false, false, false, true, false>}},
+      {{&DrawTriangle<false, false, false, true, false, false>,
+        &DrawTriangle<false, false, false, true, false, false>},
+       {&DrawTriangle<false, false, false, true, true, false>,
+        &DrawTriangle<false, false, false, true, true, false>}}},
+     {{{&DrawTriangle<false, false, false, false, false, false>,
+        &DrawTriangle<false, false, false, false, false, false>},
+       {&DrawTriangle<false, false, false, false, false, false>,
+        &DrawTriangle<false, false, false, false, false, false>}},
+      {{&DrawTriangle<false, false, false, true, false, false>,
+        &DrawTriangle<false, false, false, true, false, false>},
+       {&DrawTriangle<false, false, false, true, false, false>,
+        &DrawTriangle<false, false, false, true, false, false>}}}},
+    {{{{&DrawTriangle<false, true, false, false, false, false>,
+        &DrawTriangle<false, true, false, false, false, true>},
+       {&DrawTriangle<false, true, false, false, true, false>,
+        &DrawTriangle<false, true, false, false, true, true>}},
+      {{&DrawTriangle<false, true, false, true, false, false>,
+        &DrawTriangle<false, true, false, true, false, true>},
+       {&DrawTriangle<false, true, false, true, true, false>,
+        &DrawTriangle<false, true, false, true, true, true>}}},
+     {{{&DrawTriangle<false, true, true, false, false, false>,
+        &DrawTriangle<false, true, true, false, false, true>},
+       {&DrawTriangle<false, true, true, false, false, false>,
+        &DrawTriangle<false, true, true, false, false, true>}},
+      {{&DrawTriangle<false, true, true, true, false, false>,
+        &DrawTriangle<false, true, true, true, false, true>},
+       {&DrawTriangle<false, true, true, true, false, false>,
+        &DrawTriangle<false, true, true, true, false, true>}}}}},
+  {{{{{&DrawTriangle<true, false, false, false, false, false>,
+        &DrawTriangle<true, false, false, false, false, false>},
+       {&DrawTriangle<true, false, false, false, true, false>,
+        &DrawTriangle<true, false, false, false, true, false>}},
+      {{&DrawTriangle<true, false, false, true, false, false>,
+        &DrawTriangle<true, false, false, true, false, false>},
+       {&DrawTriangle<true, false, false, true, true, false>,
+        &DrawTriangle<true, false, false, true, true, false>}}},
+     {{{&DrawTriangle<true, false, false, false, false, false>,
+        &DrawTriangle<true, false, false, false, false, false>},
+       {&DrawTriangle<true, false, false, false, false, false>,
+        &DrawTriangle<true, false, false, false, false, false>}},
+      {{&DrawTriangle<true, false, false, true, false, false>,
+        &DrawTriangle<true, false, false, true, false, false>},
+       {&DrawTriangle<true, false, false, true, false, false>,
+        &DrawTriangle<true, false, false, true, false, false>}}}},
+    {{{{&DrawTriangle<true, true, false, false, false, false>,
+        &DrawTriangle<true, true, false, false, false, true>},
+       {&DrawTriangle<true, true, false, false, true, false>,
+        &DrawTriangle<true, true, false, false, true, true>}},
+      {{&DrawTriangle<true, true, false, true, false, false>,
+        &DrawTriangle<true, true, false, true, false, true>},
+       {&DrawTriangle<true, true, false, true, true, false>,
+        &DrawTriangle<true, true, false, true, true, true>}}},
+     {{{&DrawTriangle<true, true, true, false, false, false>,
+        &DrawTriangle<true, true, true, false, false, true>},
+       {&DrawTriangle<true, true, true, false, false, false>,
+        &DrawTriangle<true, true, true, false, false, true>}},
+      {{&DrawTriangle<true, true, true, true, false, false>,
+        &DrawTriangle<true, true, true, true, false, true>},
+       {&DrawTriangle<true, true, true, true, false, false>,
+        &DrawTriangle<true, true, true, true, false, true>}}}}}};
 
 #ifdef __INTELLISENSE__
 }
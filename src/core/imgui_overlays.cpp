@@ -6,6 +6,7 @@
 #include "controller.h"
 #include "cpu_core_private.h"
 #include "dma.h"
+#include "frame_statistics.h"
 #include "fullscreen_ui.h"
 #include "gpu.h"
 #include "host.h"
@@ -29,6 +30,7 @@
 #include "common/path.h"
 #include "common/string_util.h"
 #include "common/thirdparty/SmallVector.h"
+#include "common/threading.h"
 #include "common/timer.h"
 
 #include "IconsEmoji.h"
@@ -359,6 +361,16 @@ void ImGuiManager::DrawPerformanceOverlay(float& position_y, float scale, float
         text.assign("CPU: ");
       }
       FormatProcessorStat(text, System::GetCPUThreadUsage(), System::GetCPUThreadAverageTime());
+      if (const s32 processor = System::GetCPUThreadProcessor(); processor >= 0)
+      {
+        // Usage on an efficiency core isn't comparable to a performance core, so make it obvious where we are.
+        const Threading::ProcessorTopology& topology = Threading::GetProcessorTopology();
+        const u64 bit = static_cast<u64>(1) << processor;
+        const char* processor_class = "#";
+        if (topology.IsHeterogeneous())
+          processor_class = (topology.performance_mask & bit) ? "P" : ((topology.efficiency_mask & bit) ? "E" : "M");
+        text.append_format(" [{}{}]", processor_class, processor);
+      }
       DRAW_LINE(fixed_font, text, IM_COL32(255, 255, 255, 255));
 
       if (g_gpu->GetSWThread())
@@ -606,6 +618,33 @@ void ImGuiManager::DrawFrameTimeOverlay(float& position_y, float scale, float ma
   ImGui::PopStyleColor(3);
 
   position_y += history_size.y + spacing;
+
+  const FrameStatistics::Summary& summary = FrameStatistics::GetSummary();
+  if (summary.num_frames == 0)
+    return;
+
+  ImDrawList* dl = ImGui::GetBackgroundDrawList();
+  SmallString text;
+  const auto draw_line = [&](ImU32 color) {
+    const ImVec2 text_size =
+      fixed_font->CalcTextSizeA(fixed_font->FontSize, FLT_MAX, 0.0f, text.c_str(), text.end_ptr());
+    const ImVec2 pos(ImGui::GetIO().DisplaySize.x - margin - text_size.x, position_y);
+    dl->AddText(fixed_font, fixed_font->FontSize, ImVec2(pos.x + shadow_offset, pos.y + shadow_offset),
+                IM_COL32(0, 0, 0, 100), text.c_str(), text.end_ptr());
+    dl->AddText(fixed_font, fixed_font->FontSize, pos, color, text.c_str(), text.end_ptr());
+    position_y += text_size.y + spacing;
+  };
+
+  text.format("P50: {:.1f} | P95: {:.1f} | P99: {:.1f} | Max: {:.1f}", summary.p50_frame_time, summary.p95_frame_time,
+              summary.p99_frame_time, summary.max_frame_time);
+  draw_line(IM_COL32(255, 255, 255, 255));
+
+  if (summary.num_over_budget_frames > 0)
+  {
+    text.format("Slow: {}/{} | Last: {} ({:.1f} ms)", summary.num_over_budget_frames, summary.num_frames,
+                FrameStatistics::GetStallCauseDisplayName(summary.last_stall_cause), summary.last_stall_frame_time);
+    draw_line(IM_COL32(255, 100, 100, 255));
+  }
 }
 
 void ImGuiManager::DrawInputsOverlay()
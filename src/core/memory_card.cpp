@@ -17,8 +17,38 @@
 
 #include "IconsFontAwesome5.h"
 
+#include <algorithm>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
 Log_SetChannel(MemoryCard);
 
+namespace {
+struct PendingSave
+{
+  std::string filename;
+  std::unique_ptr<MemoryCardImage::DataArray> data;
+  bool display_osd_message;
+};
+} // namespace
+
+static void QueueBackgroundSave(const std::string& filename, const MemoryCardImage::DataArray& data,
+                                bool display_osd_message);
+static void BackgroundSaveThreadEntryPoint();
+static bool WriteCardImage(const PendingSave& save);
+static bool TakeFailedSave(const std::string& filename);
+
+static std::mutex s_save_mutex;
+static std::condition_variable s_save_done_cv;
+static std::deque<PendingSave> s_save_queue;
+static std::vector<std::string> s_failed_saves;
+static std::thread s_save_thread;
+static bool s_save_thread_running = false;
+
 MemoryCard::MemoryCard()
   : m_save_event(
       "Memory Card Host Flush", GetSaveDelayInTicks(), GetSaveDelayInTicks(),
@@ -30,7 +60,17 @@ MemoryCard::MemoryCard()
 
 MemoryCard::~MemoryCard()
 {
-  SaveIfChanged(false);
+  // Can't retry from here, so write synchronously and at least log if the data didn't make it.
+  m_save_event.Deactivate();
+  if (!m_filename.empty())
+  {
+    if (m_changed || TakeFailedSave(m_filename))
+      QueueBackgroundSave(m_filename, m_data, false);
+
+    FlushPendingSaves();
+    if (TakeFailedSave(m_filename))
+      ERROR_LOG("Memory card '{}' was not saved, changes have been lost.", Path::GetFileName(m_filename));
+  }
 }
 
 TickCount MemoryCard::GetSaveDelayInTicks()
@@ -297,6 +337,9 @@ std::unique_ptr<MemoryCard> MemoryCard::Open(std::string_view filename)
   std::unique_ptr<MemoryCard> mc = std::make_unique<MemoryCard>();
   mc->m_filename = filename;
 
+  // a card using the same file may have been swapped out and still be writing
+  FlushPendingSaves();
+
   Error error;
   if (!FileSystem::FileExists(mc->m_filename.c_str())) [[unlikely]]
   {
@@ -327,6 +370,10 @@ bool MemoryCard::SaveIfChanged(bool display_osd_message)
 {
   m_save_event.Deactivate();
 
+  // the last write didn't make it to disk, so the image is still dirty
+  if (!m_filename.empty() && TakeFailedSave(m_filename))
+    m_changed = true;
+
   if (!m_changed)
     return true;
 
@@ -335,20 +382,94 @@ bool MemoryCard::SaveIfChanged(bool display_osd_message)
   if (m_filename.empty())
     return false;
 
+  // the write itself happens on the worker thread, we only pay for the snapshot here
+  QueueBackgroundSave(m_filename, m_data, display_osd_message);
+
+  // check back once it's had time to finish, so a failed write gets retried
+  m_save_event.Schedule(GetSaveDelayInTicks());
+  return true;
+}
+
+void MemoryCard::FlushPendingSaves()
+{
+  std::unique_lock lock(s_save_mutex);
+  s_save_done_cv.wait(lock, []() { return !s_save_thread_running; });
+  if (s_save_thread.joinable())
+    s_save_thread.join();
+}
+
+void QueueBackgroundSave(const std::string& filename, const MemoryCardImage::DataArray& data, bool display_osd_message)
+{
+  std::unique_lock lock(s_save_mutex);
+
+  // coalesce with a save that hasn't been picked up yet, only the newest image matters
+  for (PendingSave& save : s_save_queue)
+  {
+    if (save.filename == filename)
+    {
+      std::memcpy(save.data->data(), data.data(), data.size());
+      save.display_osd_message |= display_osd_message;
+      return;
+    }
+  }
+
+  PendingSave& save = s_save_queue.emplace_back();
+  save.filename = filename;
+  save.data = std::make_unique<MemoryCardImage::DataArray>(data);
+  save.display_osd_message = display_osd_message;
+
+  if (!s_save_thread_running)
+  {
+    // previous worker has already left its loop, so this won't block for long
+    if (s_save_thread.joinable())
+      s_save_thread.join();
+
+    s_save_thread_running = true;
+    s_save_thread = std::thread(&BackgroundSaveThreadEntryPoint);
+  }
+}
+
+void BackgroundSaveThreadEntryPoint()
+{
+  std::unique_lock lock(s_save_mutex);
+  while (!s_save_queue.empty())
+  {
+    PendingSave save = std::move(s_save_queue.front());
+    s_save_queue.pop_front();
+
+    lock.unlock();
+    const bool result = WriteCardImage(save);
+    lock.lock();
+
+    // picked up by the card on the CPU thread, which marks itself dirty again
+    const auto it = std::find(s_failed_saves.begin(), s_failed_saves.end(), save.filename);
+    if (!result && it == s_failed_saves.end())
+      s_failed_saves.push_back(std::move(save.filename));
+    else if (result && it != s_failed_saves.end())
+      s_failed_saves.erase(it);
+  }
+
+  s_save_thread_running = false;
+  s_save_done_cv.notify_all();
+}
+
+bool WriteCardImage(const PendingSave& save)
+{
   std::string osd_key;
   std::string display_name;
-  if (display_osd_message)
+  if (save.display_osd_message)
   {
-    osd_key = fmt::format("memory_card_save_{}", m_filename);
-    display_name = FileSystem::GetDisplayNameFromPath(m_filename);
+    osd_key = fmt::format("memory_card_save_{}", save.filename);
+    display_name = FileSystem::GetDisplayNameFromPath(save.filename);
   }
 
-  INFO_LOG("Saving memory card to {}...", Path::GetFileTitle(m_filename));
+  INFO_LOG("Saving memory card to {}...", Path::GetFileTitle(save.filename));
 
   Error error;
-  if (!MemoryCardImage::SaveToFile(m_data, m_filename.c_str(), &error))
+  if (!MemoryCardImage::SaveToFile(*save.data, save.filename.c_str(), &error))
   {
-    if (display_osd_message)
+    ERROR_LOG("Failed to save memory card to {}: {}", Path::GetFileTitle(save.filename), error.GetDescription());
+    if (save.display_osd_message)
     {
       Host::AddIconOSDMessage(std::move(osd_key), ICON_FA_SD_CARD,
                               fmt::format(TRANSLATE_FS("OSDMessage", "Failed to save memory card to '{}': {}"),
@@ -359,7 +480,7 @@ bool MemoryCard::SaveIfChanged(bool display_osd_message)
     return false;
   }
 
-  if (display_osd_message)
+  if (save.display_osd_message)
   {
     Host::AddIconOSDMessage(
       std::move(osd_key), ICON_FA_SD_CARD,
@@ -370,6 +491,17 @@ bool MemoryCard::SaveIfChanged(bool display_osd_message)
   return true;
 }
 
+bool TakeFailedSave(const std::string& filename)
+{
+  std::unique_lock lock(s_save_mutex);
+  const auto it = std::find(s_failed_saves.begin(), s_failed_saves.end(), filename);
+  if (it == s_failed_saves.end())
+    return false;
+
+  s_failed_saves.erase(it);
+  return true;
+}
+
 void MemoryCard::QueueFileSave()
 {
   // skip if the event is already pending, or we don't have a backing file
@@ -41,6 +41,9 @@ public:
 
   void Format();
 
+  /// Blocks until all queued memory card writes have reached the disk.
+  static void FlushPendingSaves();
+
 private:
   enum : u32
   {
@@ -95,6 +98,8 @@ private:
 
   static TickCount GetSaveDelayInTicks();
 
+  /// Queues the image to be written on the background thread. Returns false if there's no backing file. True only
+  /// means the write was queued: if it fails, the card is marked as changed again the next time this is called.
   bool SaveIfChanged(bool display_osd_message);
   void QueueFileSave();
 
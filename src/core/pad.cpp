@@ -777,6 +777,10 @@ void Pad::DoTransfer(TickCount ticks_late)
   {
     case ActiveDevice::None:
     {
+      // Start of a controller read, the state is latched for the rest of the transfer since we only poll here.
+      if (data_out == 0x01)
+        System::PollInputForControllerRead();
+
       if (s_multitaps[s_JOY_CTRL.SLOT].IsEnabled())
       {
         if ((ack = s_multitaps[s_JOY_CTRL.SLOT].Transfer(data_out, &data_in)) == true)
@@ -3,6 +3,7 @@
 // NOTE: File has been rewritten completely compared to the original, only the enums remain.
 
 #include "pine_server.h"
+#include "bus.h"
 #include "cpu_core.h"
 #include "host.h"
 #include "settings.h"
@@ -69,6 +70,8 @@ enum IPCCommand : u8
   MsgStatus = 0xF,        /**< Returns the emulator status. */
   MsgReadBytes = 0x20,    /**< Reads range of bytes from memory. */
   MsgWriteBytes = 0x21,   /**< Writes range of bytes to memory. */
+  MsgReadBatch = 0x22,    /**< Reads a list of address/size pairs from memory. */
+  MsgWatch = 0x23,        /**< Sets the list of address/size pairs pushed to the client when changed. */
   MsgUnimplemented = 0xFF /**< Unimplemented IPC message. */
 };
 
@@ -90,8 +93,19 @@ enum class EmuStatus : u32
  * first byte sent by the IPC to differentiate between results.
  */
 using IPCStatus = u8;
-static constexpr IPCStatus IPC_OK = 0;      /**< IPC command successfully completed. */
-static constexpr IPCStatus IPC_FAIL = 0xFF; /**< IPC command failed to complete. */
+static constexpr IPCStatus IPC_OK = 0;             /**< IPC command successfully completed. */
+static constexpr IPCStatus IPC_WATCH_UPDATE = 0x01; /**< Unsolicited message with changed watch values. */
+static constexpr IPCStatus IPC_FAIL = 0xFF;        /**< IPC command failed to complete. */
+
+/**
+ * Maximum number of entries in a batch read or watch list.
+ */
+static constexpr u32 MAX_BATCH_ENTRIES = 16384;
+
+static constexpr u32 INVALID_RAM_OFFSET = 0xFFFFFFFFu;
+
+static u32 GetRAMOffset(PhysicalMemoryAddress addr, u32 size);
+static bool ReadMemoryRange(PhysicalMemoryAddress addr, u32 ram_offset, u32 size, u8* dst);
 
 namespace {
 class PINESocket final : public BufferedStreamSocket
@@ -100,6 +114,8 @@ public:
   PINESocket(SocketMultiplexer& multiplexer, SocketDescriptor descriptor);
   ~PINESocket() override;
 
+  void SendWatchUpdate();
+
 protected:
   void OnConnected() override;
   void OnDisconnected(const Error& error) override;
@@ -114,10 +130,54 @@ private:
   bool EndReply(const BinarySpanWriter& sw);
 
   bool SendErrorReply();
+
+  bool SetWatchList(BinarySpanReader& rdbuf, u32 count);
+
+  struct WatchEntry
+  {
+    PhysicalMemoryAddress address;
+    u32 size;
+    u32 ram_offset;
+    u32 value_offset;
+  };
+
+  std::vector<WatchEntry> m_watch_entries;
+  std::vector<u8> m_watch_values;
+  std::vector<u8> m_watch_current_values;
+  bool m_watch_send_all = false;
 };
 } // namespace
+
+// Sockets with an active watch list, updated at the end of each frame.
+static std::vector<std::weak_ptr<PINESocket>> s_watch_sockets;
+
 } // namespace PINEServer
 
+u32 PINEServer::GetRAMOffset(PhysicalMemoryAddress addr, u32 size)
+{
+  // Same conditions as the fast path in CPU::SafeReadMemoryBytes(), lets us skip the lookup entirely.
+  const u32 seg = (addr >> 29);
+  if ((seg != 0 && seg != 4 && seg != 5) ||
+      (((addr + size) & CPU::PHYSICAL_MEMORY_ADDRESS_MASK) >= Bus::RAM_MIRROR_END) ||
+      (((addr & Bus::g_ram_mask) + size) > Bus::g_ram_size))
+  {
+    return INVALID_RAM_OFFSET;
+  }
+
+  return (addr & Bus::g_ram_mask);
+}
+
+bool PINEServer::ReadMemoryRange(PhysicalMemoryAddress addr, u32 ram_offset, u32 size, u8* dst)
+{
+  if (ram_offset != INVALID_RAM_OFFSET)
+  {
+    std::memcpy(dst, &Bus::g_ram[ram_offset], size);
+    return true;
+  }
+
+  return CPU::SafeReadMemoryBytes(addr, dst, size);
+}
+
 bool PINEServer::IsRunning()
 {
   return static_cast<bool>(s_listen_socket);
@@ -176,8 +236,35 @@ bool PINEServer::Initialize(u16 slot)
   return true;
 }
 
+void PINEServer::FrameUpdate()
+{
+  if (s_watch_sockets.empty() || !System::IsValid())
+    return;
+
+  // Sending can close the socket, which modifies the list, so take references first.
+  std::vector<std::shared_ptr<PINESocket>> sockets;
+  sockets.reserve(s_watch_sockets.size());
+  for (auto it = s_watch_sockets.begin(); it != s_watch_sockets.end();)
+  {
+    std::shared_ptr<PINESocket> socket = it->lock();
+    if (!socket)
+    {
+      it = s_watch_sockets.erase(it);
+      continue;
+    }
+
+    sockets.push_back(std::move(socket));
+    ++it;
+  }
+
+  for (const std::shared_ptr<PINESocket>& socket : sockets)
+    socket->SendWatchUpdate();
+}
+
 void PINEServer::Shutdown()
 {
+  s_watch_sockets.clear();
+
   // also closes the listener
   if (s_listen_socket)
   {
@@ -215,6 +302,9 @@ void PINEServer::PINESocket::OnConnected()
 void PINEServer::PINESocket::OnDisconnected(const Error& error)
 {
   INFO_LOG("Client {} disconnected: {}", GetRemoteAddress().ToString(), error.GetDescription());
+
+  // Removed from the watch list on the next frame update.
+  m_watch_entries.clear();
 }
 
 void PINEServer::PINESocket::OnRead()
@@ -368,6 +458,69 @@ bool PINEServer::PINESocket::HandleCommand(IPCCommand command, BinarySpanReader
       return EndReply(reply);
     }
 
+    case MsgReadBatch:
+    {
+      // format: count (4 bytes), then count * [address (4 bytes), size (4 bytes)]
+      // reply: status, then count * [status (1 byte), data (size bytes)]
+      u32 count;
+      if (!rdbuf.ReadU32(&count) || count == 0 || count > MAX_BATCH_ENTRIES ||
+          !rdbuf.CheckRemaining(count * (sizeof(PhysicalMemoryAddress) + sizeof(u32))) || !System::IsValid())
+      {
+        return SendErrorReply();
+      }
+
+      const std::span<const u8> entries =
+        rdbuf.GetRemainingSpan(count * (sizeof(PhysicalMemoryAddress) + sizeof(u32)));
+      size_t reply_size = 0;
+      for (u32 i = 0; i < count; i++)
+      {
+        u32 size;
+        std::memcpy(&size, &entries[i * 8 + 4], sizeof(size));
+        reply_size += sizeof(IPCStatus) + size;
+      }
+      if (reply_size > (MAX_IPC_RETURN_SIZE - sizeof(u32) - sizeof(IPCStatus))) [[unlikely]]
+        return SendErrorReply();
+
+      if (!BeginReply(reply, reply_size)) [[unlikely]]
+        return false;
+
+      reply << IPC_OK;
+      for (u32 i = 0; i < count; i++)
+      {
+        PhysicalMemoryAddress addr;
+        u32 size;
+        std::memcpy(&addr, &entries[i * 8], sizeof(addr));
+        std::memcpy(&size, &entries[i * 8 + 4], sizeof(size));
+
+        const auto data = reply.GetRemainingSpan(sizeof(IPCStatus) + size);
+        const bool result = ReadMemoryRange(addr, GetRAMOffset(addr, size), size, data.data() + sizeof(IPCStatus));
+        if (!result) [[unlikely]]
+          std::memset(data.data() + sizeof(IPCStatus), 0, size);
+
+        reply << (result ? IPC_OK : IPC_FAIL);
+        reply.IncrementPosition(size);
+      }
+
+      return EndReply(reply);
+    }
+
+    case MsgWatch:
+    {
+      // format: count (4 bytes), then count * [address (4 bytes), size (4 bytes)], count of zero clears the list
+      u32 count;
+      if (!rdbuf.ReadU32(&count) || count > MAX_BATCH_ENTRIES ||
+          !rdbuf.CheckRemaining(count * (sizeof(PhysicalMemoryAddress) + sizeof(u32))))
+      {
+        return SendErrorReply();
+      }
+
+      if (!BeginReply(reply, 0)) [[unlikely]]
+        return false;
+
+      reply << (SetWatchList(rdbuf, count) ? IPC_OK : IPC_FAIL);
+      return EndReply(reply);
+    }
+
     case MsgWrite8:
     {
       // Don't do the actual write until we have space for the response, otherwise we might do it twice when we come
@@ -578,6 +731,97 @@ bool PINEServer::PINESocket::HandleCommand(IPCCommand command, BinarySpanReader
   }
 }
 
+bool PINEServer::PINESocket::SetWatchList(BinarySpanReader& rdbuf, u32 count)
+{
+  m_watch_entries.clear();
+  m_watch_values.clear();
+  m_watch_current_values.clear();
+  std::erase_if(s_watch_sockets, [this](const std::weak_ptr<PINESocket>& wp) {
+    const std::shared_ptr<PINESocket> sp = wp.lock();
+    return (!sp || sp.get() == this);
+  });
+
+  if (count == 0)
+    return true;
+
+  // Worst case update is every entry changing at once, make sure it'll fit.
+  size_t update_size = sizeof(u32) + sizeof(IPCStatus) + sizeof(u32) + sizeof(u32);
+  m_watch_entries.reserve(count);
+  for (u32 i = 0; i < count; i++)
+  {
+    const PhysicalMemoryAddress address = rdbuf.ReadU32();
+    const u32 size = rdbuf.ReadU32();
+    update_size += sizeof(u32) + size;
+    if (size == 0 || update_size > MAX_IPC_RETURN_SIZE)
+    {
+      m_watch_entries.clear();
+      m_watch_values.clear();
+      return false;
+    }
+
+    m_watch_entries.push_back(
+      WatchEntry{address, size, GetRAMOffset(address, size), static_cast<u32>(m_watch_values.size())});
+    m_watch_values.resize(m_watch_values.size() + size);
+  }
+
+  m_watch_current_values.resize(m_watch_values.size());
+  m_watch_send_all = true;
+  s_watch_sockets.push_back(std::static_pointer_cast<PINESocket>(shared_from_this()));
+  return true;
+}
+
+void PINEServer::PINESocket::SendWatchUpdate()
+{
+  // format: size (4 bytes), IPC_WATCH_UPDATE, frame number (4 bytes), count (4 bytes),
+  //         then count * [entry index (4 bytes), data (size bytes)]
+  if (m_watch_entries.empty())
+    return;
+
+  size_t changed_size = 0;
+  u32 changed_count = 0;
+  for (const WatchEntry& entry : m_watch_entries)
+  {
+    u8* current = &m_watch_current_values[entry.value_offset];
+    if (!ReadMemoryRange(entry.address, entry.ram_offset, entry.size, current))
+      std::memset(current, 0, entry.size);
+
+    if (m_watch_send_all || std::memcmp(current, &m_watch_values[entry.value_offset], entry.size) != 0)
+    {
+      changed_size += sizeof(u32) + entry.size;
+      changed_count++;
+    }
+  }
+
+  if (changed_count == 0)
+    return;
+
+  // If the client isn't keeping up, try again next frame. Values are only committed once sent.
+  // We're outside of OnRead() here, so the I/O thread could be flushing the send buffer concurrently.
+  const auto lock = GetLock();
+  BinarySpanWriter reply;
+  if (!BeginReply(reply, sizeof(u32) + sizeof(u32) + changed_size))
+    return;
+
+  reply << IPC_WATCH_UPDATE << System::GetFrameNumber() << changed_count;
+  for (u32 i = 0; i < static_cast<u32>(m_watch_entries.size()); i++)
+  {
+    const WatchEntry& entry = m_watch_entries[i];
+    const u8* current = &m_watch_current_values[entry.value_offset];
+    u8* last = &m_watch_values[entry.value_offset];
+    if (!m_watch_send_all && std::memcmp(current, last, entry.size) == 0)
+      continue;
+
+    std::memcpy(last, current, entry.size);
+    reply << i;
+    std::memcpy(reply.GetRemainingSpan(entry.size).data(), current, entry.size);
+    reply.IncrementPosition(entry.size);
+  }
+
+  m_watch_send_all = false;
+  EndReply(reply);
+  ReleaseWriteBuffer(0, true);
+}
+
 bool PINEServer::PINESocket::BeginReply(BinarySpanWriter& wrbuf, size_t required_bytes)
 {
   wrbuf = (AcquireWriteBuffer(sizeof(u32) + sizeof(IPCStatus) + required_bytes, false));
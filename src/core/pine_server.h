@@ -10,4 +10,7 @@ namespace PINEServer {
 bool IsRunning();
 bool Initialize(u16 slot);
 void Shutdown();
+
+/// Pushes changed watch list values to subscribed clients, called once per frame.
+void FrameUpdate();
 } // namespace PINEServer
@@ -6,7 +6,7 @@
 #include "common/types.h"
 
 static constexpr u32 SAVE_STATE_MAGIC = 0x43435544;
-static constexpr u32 SAVE_STATE_VERSION = 71;
+static constexpr u32 SAVE_STATE_VERSION = 72;
 static constexpr u32 SAVE_STATE_MINIMUM_VERSION = 42;
 
 static_assert(SAVE_STATE_VERSION >= SAVE_STATE_MINIMUM_VERSION);
@@ -19,6 +19,7 @@ struct SAVE_STATE_HEADER
     MAX_TITLE_LENGTH = 128,
     MAX_SERIAL_LENGTH = 32,
     MAX_SAVE_STATE_SIZE = 32 * 1024 * 1024,
+    MAX_SECTIONS = 64,
   };
 
   enum class CompressionType : u32
@@ -49,5 +50,25 @@ struct SAVE_STATE_HEADER
   u32 data_compressed_size;
   u32 data_uncompressed_size;
   u32 offset_to_data;
+
+  // Section table added in version 72.
+  // Each subsystem's data is compressed separately, so it can be read without the rest of the state.
+  u32 num_sections;
+  u32 offset_to_sections;
+};
+
+struct SAVE_STATE_SECTION_HEADER
+{
+  enum : u32
+  {
+    MAX_NAME_LENGTH = 24,
+  };
+
+  char name[MAX_NAME_LENGTH];
+  u32 compression_type;
+  u32 data_offset; // in the uncompressed state data
+  u32 data_size;
+  u32 offset_to_section;
+  u32 compressed_size;
 };
 #pragma pack(pop)
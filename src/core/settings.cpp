@@ -165,11 +165,21 @@ void Settings::Load(SettingsInterface& si, SettingsInterface& controller_si)
   rewind_save_frequency = si.GetFloatValue("Main", "RewindFrequency", 10.0f);
   rewind_save_slots = static_cast<u32>(si.GetIntValue("Main", "RewindSaveSlots", 10));
   runahead_frames = static_cast<u32>(si.GetIntValue("Main", "RunaheadFrameCount", 0));
+  input_polling_rate = static_cast<u16>(std::clamp(si.GetIntValue("Main", "InputPollingRate", 0), 0, 8000));
 
   pine_enable = si.GetBoolValue("PINE", "Enabled", false);
   pine_slot = static_cast<u16>(
     std::min<u32>(si.GetUIntValue("PINE", "Slot", DEFAULT_PINE_SLOT), std::numeric_limits<u16>::max()));
 
+  thread_placement =
+    ParseThreadPlacementModeName(
+      si.GetStringValue("Main", "ThreadPlacement", GetThreadPlacementModeName(DEFAULT_THREAD_PLACEMENT_MODE)).c_str())
+      .value_or(DEFAULT_THREAD_PLACEMENT_MODE);
+  cpu_thread_processor = static_cast<s8>(std::clamp(si.GetIntValue("Main", "CPUThreadProcessor", -1), -1, 63));
+
+  telemetry_enable = si.GetBoolValue("Telemetry", "Enabled", false);
+  telemetry_ram_regions = si.GetStringValue("Telemetry", "RAMRegions");
+
   cpu_execution_mode =
     ParseCPUExecutionMode(
       si.GetStringValue("CPU", "ExecutionMode", GetCPUExecutionModeName(DEFAULT_CPU_EXECUTION_MODE)).c_str())
@@ -294,6 +304,8 @@ void Settings::Load(SettingsInterface& si, SettingsInterface& controller_si)
   display_pre_frame_sleep = si.GetBoolValue("Display", "PreFrameSleep", false);
   display_pre_frame_sleep_buffer =
     si.GetFloatValue("Display", "PreFrameSleepBuffer", DEFAULT_DISPLAY_PRE_FRAME_SLEEP_BUFFER);
+  display_pre_frame_sleep_miss_rate = std::clamp(
+    si.GetFloatValue("Display", "PreFrameSleepMissRate", DEFAULT_DISPLAY_PRE_FRAME_SLEEP_MISS_RATE), 0.1f, 50.0f);
   display_skip_presenting_duplicate_frames = si.GetBoolValue("Display", "SkipPresentingDuplicateFrames", false);
   display_vsync = si.GetBoolValue("Display", "VSync", false);
   display_disable_mailbox_presentation = si.GetBoolValue("Display", "DisableMailboxPresentation", false);
@@ -421,6 +433,7 @@ void Settings::Load(SettingsInterface& si, SettingsInterface& controller_si)
   log_to_debug = si.GetBoolValue("Logging", "LogToDebug", false);
   log_to_window = si.GetBoolValue("Logging", "LogToWindow", false);
   log_to_file = si.GetBoolValue("Logging", "LogToFile", false);
+  log_async = si.GetBoolValue("Logging", "LogAsync", false);
 
   debugging.show_vram = si.GetBoolValue("Debug", "ShowVRAM");
   debugging.dump_cpu_to_vram_copies = si.GetBoolValue("Debug", "DumpCPUToVRAMCopies");
@@ -487,10 +500,17 @@ void Settings::Save(SettingsInterface& si, bool ignore_base) const
   si.SetFloatValue("Main", "RewindFrequency", rewind_save_frequency);
   si.SetIntValue("Main", "RewindSaveSlots", rewind_save_slots);
   si.SetIntValue("Main", "RunaheadFrameCount", runahead_frames);
+  si.SetIntValue("Main", "InputPollingRate", input_polling_rate);
 
   si.SetBoolValue("PINE", "Enabled", pine_enable);
   si.SetUIntValue("PINE", "Slot", pine_slot);
 
+  si.SetStringValue("Main", "ThreadPlacement", GetThreadPlacementModeName(thread_placement));
+  si.SetIntValue("Main", "CPUThreadProcessor", cpu_thread_processor);
+
+  si.SetBoolValue("Telemetry", "Enabled", telemetry_enable);
+  si.SetStringValue("Telemetry", "RAMRegions", telemetry_ram_regions.c_str());
+
   si.SetStringValue("CPU", "ExecutionMode", GetCPUExecutionModeName(cpu_execution_mode));
   si.SetBoolValue("CPU", "OverclockEnable", cpu_overclock_enable);
   si.SetIntValue("CPU", "OverclockNumerator", cpu_overclock_numerator);
@@ -565,6 +585,7 @@ void Settings::Save(SettingsInterface& si, bool ignore_base) const
   si.SetBoolValue("Display", "PreFrameSleep", display_pre_frame_sleep);
   si.SetBoolValue("Display", "SkipPresentingDuplicateFrames", display_skip_presenting_duplicate_frames);
   si.SetFloatValue("Display", "PreFrameSleepBuffer", display_pre_frame_sleep_buffer);
+  si.SetFloatValue("Display", "PreFrameSleepMissRate", display_pre_frame_sleep_miss_rate);
   si.SetBoolValue("Display", "VSync", display_vsync);
   si.SetBoolValue("Display", "DisableMailboxPresentation", display_disable_mailbox_presentation);
   si.SetStringValue("Display", "ExclusiveFullscreenControl",
@@ -674,6 +695,7 @@ void Settings::Save(SettingsInterface& si, bool ignore_base) const
     si.SetBoolValue("Logging", "LogToDebug", log_to_debug);
     si.SetBoolValue("Logging", "LogToWindow", log_to_window);
     si.SetBoolValue("Logging", "LogToFile", log_to_file);
+    si.SetBoolValue("Logging", "LogAsync", log_async);
 
     si.SetBoolValue("Debug", "ShowVRAM", debugging.show_vram);
     si.SetBoolValue("Debug", "DumpCPUToVRAMCopies", debugging.dump_cpu_to_vram_copies);
@@ -877,6 +899,8 @@ void Settings::UpdateLogSettings()
   {
     Log::SetFileOutputParams(false, nullptr);
   }
+
+  Log::SetAsyncOutputEnabled(log_async);
 }
 
 void Settings::SetDefaultControllerConfig(SettingsInterface& si)
@@ -1814,6 +1838,39 @@ const char* Settings::GetSaveStateCompressionModeDisplayName(SaveStateCompressio
   return Host::TranslateToCString("Settings", s_save_state_compression_mode_display_names[static_cast<size_t>(mode)]);
 }
 
+static constexpr const std::array s_thread_placement_mode_names = {"Disabled", "Automatic", "Pinned"};
+static constexpr const std::array s_thread_placement_mode_display_names = {
+  TRANSLATE_NOOP("Settings", "Disabled (OS Scheduler)"),
+  TRANSLATE_NOOP("Settings", "Automatic (Performance Core)"),
+  TRANSLATE_NOOP("Settings", "Pinned (Manual Processor)"),
+};
+static_assert(s_thread_placement_mode_names.size() == static_cast<size_t>(ThreadPlacementMode::Count));
+static_assert(s_thread_placement_mode_display_names.size() == static_cast<size_t>(ThreadPlacementMode::Count));
+
+std::optional<ThreadPlacementMode> Settings::ParseThreadPlacementModeName(const char* str)
+{
+  u32 index = 0;
+  for (const char* name : s_thread_placement_mode_names)
+  {
+    if (StringUtil::Strcasecmp(name, str) == 0)
+      return static_cast<ThreadPlacementMode>(index);
+
+    index++;
+  }
+
+  return std::nullopt;
+}
+
+const char* Settings::GetThreadPlacementModeName(ThreadPlacementMode mode)
+{
+  return s_thread_placement_mode_names[static_cast<size_t>(mode)];
+}
+
+const char* Settings::GetThreadPlacementModeDisplayName(ThreadPlacementMode mode)
+{
+  return Host::TranslateToCString("Settings", s_thread_placement_mode_display_names[static_cast<size_t>(mode)]);
+}
+
 std::string EmuFolders::AppRoot;
 std::string EmuFolders::DataRoot;
 std::string EmuFolders::Bios;
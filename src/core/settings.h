@@ -93,13 +93,18 @@ struct Settings
   bool disable_all_enhancements : 1 = false;
   bool enable_discord_presence : 1 = false;
   bool pine_enable : 1 = false;
+  bool telemetry_enable : 1 = false;
 
   bool rewind_enable : 1 = false;
   float rewind_save_frequency = 10.0f;
   u32 rewind_save_slots = 10;
   u32 runahead_frames = 0;
+  u16 input_polling_rate = 0;
   u16 pine_slot = DEFAULT_PINE_SLOT;
 
+  ThreadPlacementMode thread_placement = DEFAULT_THREAD_PLACEMENT_MODE;
+  s8 cpu_thread_processor = -1;
+
   GPURenderer gpu_renderer = DEFAULT_GPU_RENDERER;
   std::string gpu_adapter;
   u8 gpu_resolution_scale = 1;
@@ -176,6 +181,7 @@ struct Settings
   bool display_show_enhancements : 1 = false;
   bool display_stretch_vertically : 1 = false;
   float display_pre_frame_sleep_buffer = DEFAULT_DISPLAY_PRE_FRAME_SLEEP_BUFFER;
+  float display_pre_frame_sleep_miss_rate = DEFAULT_DISPLAY_PRE_FRAME_SLEEP_MISS_RATE;
   float display_osd_scale = 100.0f;
   float gpu_pgxp_tolerance = -1.0f;
   float gpu_pgxp_depth_clear_threshold = DEFAULT_GPU_PGXP_DEPTH_THRESHOLD / GPU_PGXP_DEPTH_THRESHOLD_SCALE;
@@ -275,6 +281,8 @@ struct Settings
   std::string pcdrv_root;
   bool pcdrv_enable_writes = false;
 
+  std::string telemetry_ram_regions;
+
   LOGLEVEL log_level = DEFAULT_LOG_LEVEL;
   std::string log_filter;
   bool log_timestamps : 1 = true;
@@ -282,6 +290,7 @@ struct Settings
   bool log_to_debug : 1 = false;
   bool log_to_window : 1 = false;
   bool log_to_file : 1 = false;
+  bool log_async : 1 = false;
 
   ALWAYS_INLINE bool IsUsingSoftwareRenderer() const { return (gpu_renderer == GPURenderer::Software); }
   ALWAYS_INLINE bool IsUsingAccurateBlending() const { return (gpu_accurate_blending && !gpu_true_color); }
@@ -463,6 +472,10 @@ struct Settings
   static const char* GetSaveStateCompressionModeName(SaveStateCompressionMode mode);
   static const char* GetSaveStateCompressionModeDisplayName(SaveStateCompressionMode mode);
 
+  static std::optional<ThreadPlacementMode> ParseThreadPlacementModeName(const char* str);
+  static const char* GetThreadPlacementModeName(ThreadPlacementMode mode);
+  static const char* GetThreadPlacementModeDisplayName(ThreadPlacementMode mode);
+
   static constexpr GPURenderer DEFAULT_GPU_RENDERER = GPURenderer::Automatic;
   static constexpr GPUTextureFilter DEFAULT_GPU_TEXTURE_FILTER = GPUTextureFilter::Nearest;
   static constexpr GPULineDetectMode DEFAULT_GPU_LINE_DETECT_MODE = GPULineDetectMode::Disabled;
@@ -498,6 +511,7 @@ struct Settings
   static constexpr DisplayScreenshotFormat DEFAULT_DISPLAY_SCREENSHOT_FORMAT = DisplayScreenshotFormat::PNG;
   static constexpr u8 DEFAULT_DISPLAY_SCREENSHOT_QUALITY = 85;
   static constexpr float DEFAULT_DISPLAY_PRE_FRAME_SLEEP_BUFFER = 2.0f;
+  static constexpr float DEFAULT_DISPLAY_PRE_FRAME_SLEEP_MISS_RATE = 1.0f;
   static constexpr float DEFAULT_OSD_SCALE = 100.0f;
 
   static constexpr u8 DEFAULT_CDROM_READAHEAD_SECTORS = 8;
@@ -515,6 +529,7 @@ struct Settings
   static constexpr LOGLEVEL DEFAULT_LOG_LEVEL = LOGLEVEL_INFO;
 
   static constexpr SaveStateCompressionMode DEFAULT_SAVE_STATE_COMPRESSION_MODE = SaveStateCompressionMode::ZstDefault;
+  static constexpr ThreadPlacementMode DEFAULT_THREAD_PLACEMENT_MODE = ThreadPlacementMode::Automatic;
 
 #ifndef __ANDROID__
   static const MediaCaptureBackend DEFAULT_MEDIA_CAPTURE_BACKEND;
@@ -0,0 +1,197 @@
+// SPDX-FileCopyrightText: 2019-2024 Connor McLaughlin <stenzek@gmail.com>
+// SPDX-License-Identifier: (GPL-3.0 OR CC-BY-NC-ND-4.0)
+
+#include "shared_telemetry.h"
+#include "cpu_core.h"
+#include "system.h"
+#include "timing_event.h"
+
+#include "common/align.h"
+#include "common/error.h"
+#include "common/log.h"
+#include "common/memmap.h"
+#include "common/string_util.h"
+#include "common/timer.h"
+
+#include <vector>
+
+Log_SetChannel(SharedTelemetry);
+
+namespace SharedTelemetry {
+
+static bool ParseRAMRegions(std::string_view str, std::vector<RAMRegion>* regions);
+static void BeginUpdate();
+static void EndUpdate();
+
+static std::string s_shmem_name;
+static void* s_shmem_handle = nullptr;
+static u8* s_shmem_ptr = nullptr;
+static size_t s_shmem_size = 0;
+
+// Kept privately, since the copy in the header can be modified by anyone with the mapping.
+static std::vector<RAMRegion> s_ram_regions;
+
+} // namespace SharedTelemetry
+
+bool SharedTelemetry::ParseRAMRegions(std::string_view str, std::vector<RAMRegion>* regions)
+{
+  size_t data_offset = Common::AlignUpPow2(sizeof(Header), 16);
+  for (const std::string_view& region : StringUtil::SplitString(str, ',', true))
+  {
+    const std::string_view::size_type sep = region.find(':');
+    const std::optional<u32> address =
+      (sep != std::string_view::npos) ? StringUtil::FromChars<u32>(region.substr(0, sep), 16) : std::nullopt;
+    const std::optional<u32> size =
+      (sep != std::string_view::npos) ? StringUtil::FromChars<u32>(region.substr(sep + 1), 16) : std::nullopt;
+    if (!address.has_value() || !size.has_value() || size.value() == 0)
+    {
+      ERROR_LOG("Malformed RAM region '{}'", region);
+      return false;
+    }
+
+    if (regions->size() == MAX_RAM_REGIONS || size.value() > MAX_RAM_REGION_BYTES ||
+        (data_offset + size.value()) > (sizeof(Header) + MAX_RAM_REGION_BYTES))
+    {
+      ERROR_LOG("Too many RAM regions, limit is {} regions or {} bytes.", MAX_RAM_REGIONS, MAX_RAM_REGION_BYTES);
+      return false;
+    }
+
+    regions->push_back(RAMRegion{address.value(), size.value(), static_cast<u32>(data_offset), 0});
+    data_offset = Common::AlignUpPow2(data_offset + size.value(), 16);
+  }
+
+  return true;
+}
+
+bool SharedTelemetry::IsActive()
+{
+  return (s_shmem_ptr != nullptr);
+}
+
+bool SharedTelemetry::Initialize(std::string_view ram_regions)
+{
+  Shutdown();
+
+  std::vector<RAMRegion> regions;
+  if (!ParseRAMRegions(ram_regions, &regions))
+    return false;
+
+  const size_t data_size = regions.empty() ? sizeof(Header) : (regions.back().data_offset + regions.back().size);
+  const size_t total_size = Common::AlignUpPow2(data_size, HOST_PAGE_SIZE);
+
+  Error error;
+  s_shmem_name = MemMap::GetFileMappingName("duckstation_telemetry");
+  s_shmem_handle = MemMap::CreateSharedMemory(s_shmem_name.c_str(), total_size, &error);
+  if (!s_shmem_handle)
+  {
+    ERROR_LOG("Failed to create shared memory: {}", error.GetDescription());
+    s_shmem_name = {};
+    return false;
+  }
+
+  s_shmem_ptr =
+    static_cast<u8*>(MemMap::MapSharedMemory(s_shmem_handle, 0, nullptr, total_size, PageProtect::ReadWrite));
+  if (!s_shmem_ptr)
+  {
+    ERROR_LOG("Failed to map shared memory.");
+    Shutdown();
+    return false;
+  }
+
+  s_shmem_size = total_size;
+  std::memset(s_shmem_ptr, 0, total_size);
+
+  Header* hdr = reinterpret_cast<Header*>(s_shmem_ptr);
+  hdr->magic = MAGIC;
+  hdr->version = VERSION;
+  hdr->header_size = sizeof(Header);
+  hdr->total_size = static_cast<u32>(total_size);
+  hdr->num_ram_regions = static_cast<u32>(regions.size());
+  std::copy(regions.begin(), regions.end(), hdr->ram_regions);
+  s_ram_regions = std::move(regions);
+
+  INFO_LOG("Telemetry shared memory object name is \"{}\", {} bytes with {} RAM regions.", s_shmem_name, total_size,
+           s_ram_regions.size());
+  return true;
+}
+
+void SharedTelemetry::Shutdown()
+{
+  s_ram_regions = {};
+
+  if (s_shmem_ptr)
+  {
+    MemMap::UnmapSharedMemory(s_shmem_ptr, s_shmem_size);
+    s_shmem_ptr = nullptr;
+    s_shmem_size = 0;
+  }
+
+  if (s_shmem_handle)
+  {
+    MemMap::DestroySharedMemory(s_shmem_handle);
+    s_shmem_handle = nullptr;
+  }
+
+  if (!s_shmem_name.empty())
+  {
+    MemMap::DeleteSharedMemory(s_shmem_name.c_str());
+    s_shmem_name = {};
+  }
+}
+
+void SharedTelemetry::BeginUpdate()
+{
+  Header* hdr = reinterpret_cast<Header*>(s_shmem_ptr);
+  hdr->sequence.store(hdr->sequence.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+}
+
+void SharedTelemetry::EndUpdate()
+{
+  Header* hdr = reinterpret_cast<Header*>(s_shmem_ptr);
+  hdr->sequence.store(hdr->sequence.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+}
+
+void SharedTelemetry::FrameUpdate()
+{
+  if (!s_shmem_ptr)
+    return;
+
+  Header* hdr = reinterpret_cast<Header*>(s_shmem_ptr);
+  BeginUpdate();
+
+  hdr->system_valid = System::IsValid();
+  hdr->frame_number = System::GetFrameNumber();
+  hdr->internal_frame_number = System::GetInternalFrameNumber();
+  hdr->global_tick_counter = TimingEvents::GetGlobalTickCounter();
+  hdr->host_time_ns =
+    static_cast<u64>(Common::Timer::ConvertValueToNanoseconds(Common::Timer::GetCurrentValue()));
+
+  hdr->fps = System::GetFPS();
+  hdr->vps = System::GetVPS();
+  hdr->speed = System::GetEmulationSpeed();
+  hdr->average_frame_time = System::GetAverageFrameTime();
+  hdr->minimum_frame_time = System::GetMinimumFrameTime();
+  hdr->maximum_frame_time = System::GetMaximumFrameTime();
+  hdr->cpu_thread_usage = System::GetCPUThreadUsage();
+  hdr->cpu_thread_time = System::GetCPUThreadAverageTime();
+  hdr->sw_thread_usage = System::GetSWThreadUsage();
+  hdr->sw_thread_time = System::GetSWThreadAverageTime();
+  hdr->gpu_usage = System::GetGPUUsage();
+  hdr->gpu_time = System::GetGPUAverageTime();
+
+  hdr->cpu_pc = CPU::g_state.pc;
+  std::memcpy(hdr->cpu_regs, CPU::g_state.regs.r, sizeof(hdr->cpu_regs));
+  hdr->cop0_sr = CPU::g_state.cop0_regs.sr.bits;
+  hdr->cop0_cause = CPU::g_state.cop0_regs.cause.bits;
+  hdr->cop0_epc = CPU::g_state.cop0_regs.EPC;
+
+  for (const RAMRegion& region : s_ram_regions)
+  {
+    u8* dst = s_shmem_ptr + region.data_offset;
+    if (!hdr->system_valid || !CPU::SafeReadMemoryBytes(region.address, dst, region.size))
+      std::memset(dst, 0, region.size);
+  }
+
+  EndUpdate();
+}
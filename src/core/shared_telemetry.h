@@ -0,0 +1,79 @@
+// SPDX-FileCopyrightText: 2019-2024 Connor McLaughlin <stenzek@gmail.com>
+// SPDX-License-Identifier: (GPL-3.0 OR CC-BY-NC-ND-4.0)
+
+#pragma once
+
+#include "types.h"
+
+#include <atomic>
+#include <string_view>
+
+//////////////////////////////////////////////////////////////////////////
+// Shared memory segment for external observers, updated once per frame.
+//////////////////////////////////////////////////////////////////////////
+
+namespace SharedTelemetry {
+
+static constexpr u32 MAGIC = 0x4D545344; // DSTM
+static constexpr u32 VERSION = 1;
+static constexpr u32 MAX_RAM_REGIONS = 64;
+static constexpr u32 MAX_RAM_REGION_BYTES = 2 * 1024 * 1024;
+
+struct RAMRegion
+{
+  u32 address;
+  u32 size;
+  u32 data_offset; // relative to the start of the segment
+  u32 reserved;
+};
+
+// Readers should copy the header and region data between two loads of sequence, retrying if the value changed or was
+// odd, which indicates that an update is in progress.
+struct Header
+{
+  u32 magic;
+  u32 version;
+  u32 header_size;
+  u32 total_size;
+
+  std::atomic<u32> sequence;
+  u32 system_valid;
+  u32 frame_number;
+  u32 internal_frame_number;
+  u64 global_tick_counter;
+  u64 host_time_ns;
+
+  float fps;
+  float vps;
+  float speed;
+  float average_frame_time;
+  float minimum_frame_time;
+  float maximum_frame_time;
+  float cpu_thread_usage;
+  float cpu_thread_time;
+  float sw_thread_usage;
+  float sw_thread_time;
+  float gpu_usage;
+  float gpu_time;
+
+  u32 cpu_pc;
+  u32 cpu_regs[32];
+  u32 cop0_sr;
+  u32 cop0_cause;
+  u32 cop0_epc;
+
+  u32 num_ram_regions;
+  RAMRegion ram_regions[MAX_RAM_REGIONS];
+};
+static_assert(std::atomic<u32>::is_always_lock_free);
+
+bool IsActive();
+
+/// Regions are specified as comma-separated address:size pairs in hex, e.g. "80010000:100,800F0000:40".
+bool Initialize(std::string_view ram_regions);
+void Shutdown();
+
+/// Publishes the current state, called at the end of each frame.
+void FrameUpdate();
+
+} // namespace SharedTelemetry
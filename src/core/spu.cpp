@@ -55,7 +55,8 @@ enum : u32
   CAPTURE_BUFFER_SIZE_PER_CHANNEL = 0x400,
   MINIMUM_TICKS_BETWEEN_KEY_ON_OFF = 2,
   NUM_REVERB_REGS = 32,
-  FIFO_SIZE_IN_HALFWORDS = 32
+  FIFO_SIZE_IN_HALFWORDS = 32,
+  MUTED_OUTPUT_BUFFER_FRAMES = 256
 };
 enum : TickCount
 {
@@ -412,7 +413,9 @@ struct SPUState
   InlineFIFOQueue<u16, FIFO_SIZE_IN_HALFWORDS> transfer_fifo;
 
   std::unique_ptr<AudioStream> audio_stream;
-  std::unique_ptr<AudioStream> null_audio_stream;
+
+  // Scratch space for the mix when output is muted (runahead replay), the samples are never consumed.
+  std::array<s16, MUTED_OUTPUT_BUFFER_FRAMES * 2> muted_output_buffer;
 
   s16 last_reverb_input[2];
   s32 last_reverb_output[2];
@@ -437,7 +440,6 @@ void SPU::Initialize()
   s_state.cpu_tick_divider = static_cast<TickCount>(g_settings.cpu_overclock_numerator * SYSCLK_TICKS_PER_SPU_TICK);
   s_state.tick_event.SetInterval(s_state.cpu_ticks_per_spu_tick);
   s_state.tick_event.SetPeriod(s_state.cpu_ticks_per_spu_tick);
-  s_state.null_audio_stream = AudioStream::CreateNullStream(SAMPLE_RATE, g_settings.audio_stream_parameters.buffer_ms);
 
   CreateOutputStream();
   Reset();
@@ -2342,14 +2344,24 @@ void SPU::Execute(void* param, TickCount ticks, TickCount ticks_late)
     s_state.ticks_carry = (ticks + s_state.ticks_carry) % SYSCLK_TICKS_PER_SPU_TICK;
   }
 
-  AudioStream* output_stream =
-    s_state.audio_output_muted ? s_state.null_audio_stream.get() : s_state.audio_stream.get();
+  // When muted, we still have to run the voices and reverb, since they affect SPU RAM and the capture buffers.
+  // But there's no point pushing the output through a stream or to media capture, because it'll be thrown away.
+  const bool output_muted = s_state.audio_output_muted;
+  AudioStream* output_stream = s_state.audio_stream.get();
 
   while (remaining_frames > 0)
   {
     s16* output_frame_start;
     u32 output_frame_space = remaining_frames;
-    output_stream->BeginWrite(&output_frame_start, &output_frame_space);
+    if (output_muted)
+    {
+      output_frame_start = s_state.muted_output_buffer.data();
+      output_frame_space = MUTED_OUTPUT_BUFFER_FRAMES;
+    }
+    else
+    {
+      output_stream->BeginWrite(&output_frame_start, &output_frame_space);
+    }
 
     s16* output_frame = output_frame_start;
     const u32 frames_in_this_batch = std::min(remaining_frames, output_frame_space);
@@ -2450,6 +2462,10 @@ void SPU::Execute(void* param, TickCount ticks, TickCount ticks_late)
       }
     }
 
+    remaining_frames -= frames_in_this_batch;
+    if (output_muted)
+      continue;
+
 #ifndef __ANDROID__
     if (MediaCapture* cap = System::GetMediaCapture()) [[unlikely]]
     {
@@ -2459,7 +2475,6 @@ void SPU::Execute(void* param, TickCount ticks, TickCount ticks_late)
 #endif
 
     output_stream->EndWrite(frames_in_this_batch);
-    remaining_frames -= frames_in_this_batch;
   }
 }
 
@@ -12,6 +12,8 @@
 #include "cpu_core.h"
 #include "cpu_pgxp.h"
 #include "dma.h"
+#include "frame_pacer.h"
+#include "frame_statistics.h"
 #include "fullscreen_ui.h"
 #include "game_database.h"
 #include "game_list.h"
@@ -28,6 +30,7 @@
 #include "pcdrv.h"
 #include "psf_loader.h"
 #include "save_state_version.h"
+#include "shared_telemetry.h"
 #include "sio.h"
 #include "spu.h"
 #include "texture_replacements.h"
@@ -50,6 +53,7 @@
 
 #include "common/align.h"
 #include "common/binary_reader_writer.h"
+#include "common/bitutils.h"
 #include "common/dynamic_library.h"
 #include "common/error.h"
 #include "common/file_system.h"
@@ -57,6 +61,7 @@
 #include "common/log.h"
 #include "common/path.h"
 #include "common/string_util.h"
+#include "common/task_scheduler.h"
 #include "common/threading.h"
 
 #include "IconsEmoji.h"
@@ -68,6 +73,7 @@
 #include "imgui.h"
 #include "xxhash.h"
 
+#include <algorithm>
 #include <cctype>
 #include <cinttypes>
 #include <cmath>
@@ -115,6 +121,11 @@ SystemBootParameters::~SystemBootParameters() = default;
 namespace System {
 /// Memory save states - only for internal use.
 namespace {
+struct SaveStateSection
+{
+  const char* name;
+  u32 offset;
+};
 struct SaveStateBuffer
 {
   std::string serial;
@@ -125,6 +136,7 @@ struct SaveStateBuffer
   RGBA8Image screenshot;
   DynamicHeapArray<u8> state_data;
   size_t state_size;
+  std::vector<SaveStateSection> sections;
 };
 struct MemorySaveState
 {
@@ -170,11 +182,13 @@ static void ResetThrottler();
 /// Throttles the system, i.e. sleeps until it's time to execute the next frame.
 static void Throttle(Common::Timer::Value current_time);
 static void UpdatePerformanceCounters();
-static void AccumulatePreFrameSleepTime();
-static void UpdatePreFrameSleepTime();
+static void UpdatePreFrameSleepTime(Common::Timer::Value current_time);
 static void UpdateDisplayVSync();
 static void ResetPerformanceCounters();
 
+/// Pins the CPU thread and keeps helper threads off its core, depending on the thread placement setting.
+static void UpdateThreadPlacement();
+
 static bool UpdateGameSettingsLayer();
 static void UpdateRunningGame(const std::string_view path, CDImage* image, bool booting);
 static bool CheckForSBIFile(CDImage* image, Error* error);
@@ -193,18 +207,27 @@ static bool SaveUndoLoadState();
 static void UpdateMemorySaveStateSettings();
 static bool LoadRewindState(u32 skip_saves = 0, bool consume_state = true);
 static bool SaveMemoryState(MemorySaveState* mss);
-static bool LoadMemoryState(const MemorySaveState& mss);
+static bool LoadMemoryState(const MemorySaveState& mss, bool update_display);
 static bool LoadStateFromBuffer(const SaveStateBuffer& buffer, Error* error, bool update_display);
 static bool LoadStateBufferFromFile(SaveStateBuffer* buffer, std::FILE* fp, Error* error, bool read_title,
                                     bool read_media_path, bool read_screenshot, bool read_data);
+static bool ReadStateHeader(std::FILE* fp, SAVE_STATE_HEADER* header, s64* file_size, Error* error);
+static bool ReadStateSectionTable(std::FILE* fp, const SAVE_STATE_HEADER& header, s64 file_size,
+                                  std::vector<SAVE_STATE_SECTION_HEADER>* sections, Error* error);
+static bool ReadAndDecompressStateSections(std::FILE* fp, std::span<u8> dst,
+                                           std::span<const SAVE_STATE_SECTION_HEADER> sections, Error* error);
 static bool ReadAndDecompressStateData(std::FILE* fp, std::span<u8> dst, u32 file_offset, u32 compressed_size,
                                        SAVE_STATE_HEADER::CompressionType method, Error* error);
+static bool DecompressStateData(std::span<u8> dst, std::span<const u8> src, SAVE_STATE_HEADER::CompressionType method,
+                                Error* error);
 static bool SaveStateToBuffer(SaveStateBuffer* buffer, Error* error, u32 screenshot_size = 256);
 static bool SaveStateBufferToFile(const SaveStateBuffer& buffer, std::FILE* fp, Error* error,
                                   SaveStateCompressionMode compression_mode);
 static u32 CompressAndWriteStateData(std::FILE* fp, std::span<const u8> src, SaveStateCompressionMode method,
                                      u32* header_type, Error* error);
-static bool DoState(StateWrapper& sw, GPUTexture** host_texture, bool update_display, bool is_memory_state);
+static bool DoState(StateWrapper& sw, GPUTexture** host_texture, bool update_display, bool is_memory_state,
+                    std::vector<SaveStateSection>* sections = nullptr);
+static bool DoStateSection(StateWrapper& sw, const char* name, std::vector<SaveStateSection>* sections);
 
 static bool IsExecutionInterrupted();
 static void CheckForAndExitExecution();
@@ -281,7 +304,7 @@ static Common::Timer::Value s_next_frame_time = 0;
 static Common::Timer::Value s_frame_start_time = 0;
 static Common::Timer::Value s_last_active_frame_time = 0;
 static Common::Timer::Value s_pre_frame_sleep_time = 0;
-static Common::Timer::Value s_max_active_frame_time = 0;
+static FramePacer s_frame_pacer;
 
 static float s_average_frame_time_accumulator = 0.0f;
 static float s_minimum_frame_time_accumulator = 0.0f;
@@ -300,6 +323,13 @@ static float s_sw_thread_time = 0.0f;
 static float s_average_gpu_time = 0.0f;
 static float s_accumulated_gpu_time = 0.0f;
 static float s_gpu_usage = 0.0f;
+static float s_input_latency = 0.0f;
+static float s_accumulated_input_latency = 0.0f;
+static float s_average_input_dispatch_time = 0.0f;
+static float s_maximum_input_dispatch_time = 0.0f;
+static float s_average_input_read_latency = 0.0f;
+static float s_maximum_input_read_latency = 0.0f;
+static u32 s_input_latency_samples = 0;
 static System::FrameTimeHistory s_frame_time_history;
 static u32 s_frame_time_history_pos = 0;
 static u32 s_last_frame_number = 0;
@@ -311,6 +341,9 @@ static u32 s_presents_since_last_update = 0;
 static Common::Timer s_fps_timer;
 static Common::Timer s_frame_timer;
 static Threading::ThreadHandle s_cpu_thread_handle;
+static s32 s_cpu_thread_processor = -1;
+static bool s_thread_placement_active = false;
+static u64 s_startup_affinity_mask = 0; // zero if unknown, which means all processors
 
 static std::unique_ptr<CheatList> s_cheat_list;
 static std::unique_ptr<MediaCapture> s_media_capture;
@@ -327,6 +360,9 @@ static s32 s_rewind_save_frequency = -1;
 static s32 s_rewind_save_counter = -1;
 static bool s_rewinding_first_save = false;
 
+// Runahead replays on the CPU thread, so its cost adds to the frame time. Running a second "shadow" instance ahead on
+// another core isn't possible yet, since CPU/Bus/GPU/SPU/etc state lives in namespace-level globals and can't be
+// instantiated twice. The replay frames themselves are kept as cheap as possible, see IsRunaheadReplayFrame().
 static std::deque<System::MemorySaveState> s_runahead_states;
 static bool s_runahead_replay_pending = false;
 static u32 s_runahead_frames = 0;
@@ -459,11 +495,15 @@ bool System::Internal::ProcessStartup(Error* error)
 
   CheckCacheLineSize();
 
+  // Remember what we were started with, so that turning placement off can put it back.
+  s_startup_affinity_mask = Threading::GetAllowedProcessorMask();
+
   return true;
 }
 
 void System::Internal::ProcessShutdown()
 {
+  TaskScheduler::Shutdown();
   Bus::ReleaseMemory();
   CPU::CodeCache::ProcessShutdown();
 }
@@ -502,11 +542,16 @@ bool System::Internal::CPUThreadInitialize(Error* error)
     PINEServer::Initialize(g_settings.pine_slot);
 #endif
 
+  if (g_settings.telemetry_enable)
+    SharedTelemetry::Initialize(g_settings.telemetry_ram_regions);
+
   return true;
 }
 
 void System::Internal::CPUThreadShutdown()
 {
+  SharedTelemetry::Shutdown();
+
 #ifdef ENABLE_PINE_SERVER
   PINEServer::Shutdown();
 #endif
@@ -748,6 +793,10 @@ float System::GetCPUThreadAverageTime()
 {
   return s_cpu_thread_time;
 }
+s32 System::GetCPUThreadProcessor()
+{
+  return s_cpu_thread_processor;
+}
 float System::GetSWThreadUsage()
 {
   return s_sw_thread_usage;
@@ -1781,6 +1830,7 @@ bool System::BootSystem(SystemBootParameters parameters, Error* error)
     PauseSystem(true);
 
   UpdateSpeedLimiterState();
+  UpdateThreadPlacement();
   ResetPerformanceCounters();
   return true;
 }
@@ -1820,6 +1870,9 @@ bool System::Initialize(bool force_software_renderer, Error* error)
   s_average_gpu_time = 0.0f;
   s_accumulated_gpu_time = 0.0f;
   s_gpu_usage = 0.0f;
+  s_input_latency = 0.0f;
+  s_accumulated_input_latency = 0.0f;
+  s_input_latency_samples = 0;
   s_last_frame_number = 0;
   s_last_internal_frame_number = 0;
   s_last_global_tick_counter = 0;
@@ -1829,6 +1882,8 @@ bool System::Initialize(bool force_software_renderer, Error* error)
   s_frame_timer.Reset();
   s_frame_time_history.fill(0.0f);
   s_frame_time_history_pos = 0;
+  FrameStatistics::Reset();
+  s_frame_pacer.Reset();
 
   TimingEvents::Initialize();
 
@@ -2023,8 +2078,10 @@ void System::FrameDone()
   g_gpu->FlushRender();
 
   // Generate any pending samples from the SPU before sleeping, this way we reduce the chances of underruns.
-  // TODO: when running ahead, we can skip this (and the flush above)
-  SPU::GeneratePendingSamples();
+  // Not needed when replaying for runahead, since we're not going to sleep, and the output is muted anyway.
+  const bool runahead_replay_frame = IsRunaheadReplayFrame();
+  if (!runahead_replay_frame)
+    SPU::GeneratePendingSamples();
 
   if (s_cheat_list)
     s_cheat_list->Apply();
@@ -2032,10 +2089,24 @@ void System::FrameDone()
   if (Achievements::IsActive())
     Achievements::FrameUpdate();
 
+  // Host-side polling can wait until the frame which actually gets displayed.
+  if (runahead_replay_frame)
+  {
+    DoRunahead();
+    return;
+  }
+
 #ifdef ENABLE_DISCORD_PRESENCE
   PollDiscordPresence();
 #endif
 
+#ifdef ENABLE_PINE_SERVER
+  PINEServer::FrameUpdate();
+#endif
+
+  if (SharedTelemetry::IsActive())
+    SharedTelemetry::FrameUpdate();
+
 #ifdef ENABLE_SOCKET_MULTIPLEXER
   if (s_socket_multiplexer)
     s_socket_multiplexer->PollEventsWithTimeout(0);
@@ -2111,10 +2182,11 @@ void System::FrameDone()
   Common::Timer::Value current_time = Common::Timer::GetCurrentValue();
 
   // pre-frame sleep accounting (input lag reduction)
-  const Common::Timer::Value pre_frame_sleep_until = s_next_frame_time + s_pre_frame_sleep_time;
   s_last_active_frame_time = current_time - s_frame_start_time;
+  FrameStatistics::AddPhaseTime(FrameStatistics::Phase::Emulation, current_time - s_frame_timer.GetStartValue());
   if (s_pre_frame_sleep)
-    AccumulatePreFrameSleepTime();
+    UpdatePreFrameSleepTime(current_time);
+  const Common::Timer::Value pre_frame_sleep_until = s_next_frame_time + s_pre_frame_sleep_time;
 
   // explicit present (frame pacing)
   const bool is_unique_frame = (s_last_presented_internal_frame_number != s_internal_frame_number);
@@ -2137,7 +2209,12 @@ void System::FrameDone()
       const bool do_present = PresentDisplay(false, true);
       Throttle(current_time);
       if (do_present)
+      {
+        const Common::Timer::Value present_start_time = Common::Timer::GetCurrentValue();
         g_gpu_device->SubmitPresent();
+        FrameStatistics::AddPhaseTime(FrameStatistics::Phase::Present,
+                                      Common::Timer::GetCurrentValue() - present_start_time);
+      }
     }
     else
     {
@@ -2158,6 +2235,15 @@ void System::FrameDone()
       Throttle(current_time);
   }
 
+  // Input was polled at the start of the frame, so this is how long it took to get to the screen, give or take
+  // the time the driver/compositor holds on to it.
+  if (!skip_this_frame)
+  {
+    const Common::Timer::Value latency = Common::Timer::GetCurrentValue() - s_frame_timer.GetStartValue();
+    s_accumulated_input_latency += static_cast<float>(Common::Timer::ConvertValueToMilliseconds(latency));
+    s_input_latency_samples++;
+  }
+
   // pre-frame sleep (input lag reduction)
   current_time = Common::Timer::GetCurrentValue();
   if (s_pre_frame_sleep)
@@ -2167,7 +2253,8 @@ void System::FrameDone()
         Common::Timer::ConvertValueToMilliseconds(pre_frame_sleep_until - current_time) >= 1)
     {
       Common::Timer::SleepUntil(pre_frame_sleep_until, true);
-      current_time = Common::Timer::GetCurrentValue();
+      const Common::Timer::Value sleep_start_time = std::exchange(current_time, Common::Timer::GetCurrentValue());
+      FrameStatistics::AddPhaseTime(FrameStatistics::Phase::PreFrameSleep, current_time - sleep_start_time);
     }
   }
 
@@ -2232,6 +2319,9 @@ void System::Throttle(Common::Timer::Value current_time)
     return;
   }
 
+  // current_time is stale if the caller presented before throttling, so time the sleep itself.
+  const Common::Timer::Value sleep_start_time = Common::Timer::GetCurrentValue();
+
 #ifdef ENABLE_SOCKET_MULTIPLEXER
   // If we are using the socket multiplier, and have clients, then use it to sleep instead.
   // That way in a query->response->query->response chain, we don't process only one message per frame.
@@ -2270,6 +2360,8 @@ void System::Throttle(Common::Timer::Value current_time)
           Common::Timer::ConvertValueToMilliseconds(Common::Timer::GetCurrentValue() - s_next_frame_time));
 #endif
 
+  FrameStatistics::AddPhaseTime(FrameStatistics::Phase::Throttle, Common::Timer::GetCurrentValue() - sleep_start_time);
+
   s_next_frame_time += s_frame_period;
 }
 
@@ -2343,9 +2435,19 @@ bool System::CreateGPU(GPURenderer renderer, bool is_switching, Error* error)
   return true;
 }
 
-bool System::DoState(StateWrapper& sw, GPUTexture** host_texture, bool update_display, bool is_memory_state)
+bool System::DoStateSection(StateWrapper& sw, const char* name, std::vector<SaveStateSection>* sections)
 {
-  if (!sw.DoMarker("System"))
+  // Sections run from their marker up to the next section's marker.
+  if (sections)
+    sections->push_back(SaveStateSection{name, static_cast<u32>(sw.GetPosition())});
+
+  return sw.DoMarker(name);
+}
+
+bool System::DoState(StateWrapper& sw, GPUTexture** host_texture, bool update_display, bool is_memory_state,
+                     std::vector<SaveStateSection>* sections /* = nullptr */)
+{
+  if (!DoStateSection(sw, "System", sections))
     return false;
 
   sw.Do(&s_region);
@@ -2368,7 +2470,7 @@ bool System::DoState(StateWrapper& sw, GPUTexture** host_texture, bool update_di
     }
   }
 
-  if (!sw.DoMarker("CPU") || !CPU::DoState(sw))
+  if (!DoStateSection(sw, "CPU", sections) || !CPU::DoState(sw))
     return false;
 
   if (sw.IsReading())
@@ -2384,41 +2486,41 @@ bool System::DoState(StateWrapper& sw, GPUTexture** host_texture, bool update_di
   if (sw.IsReading() && g_settings.gpu_pgxp_enable && !is_memory_state)
     CPU::PGXP::Reset();
 
-  if (!sw.DoMarker("Bus") || !Bus::DoState(sw))
+  if (!DoStateSection(sw, "Bus", sections) || !Bus::DoState(sw))
     return false;
 
-  if (!sw.DoMarker("DMA") || !DMA::DoState(sw))
+  if (!DoStateSection(sw, "DMA", sections) || !DMA::DoState(sw))
     return false;
 
-  if (!sw.DoMarker("InterruptController") || !InterruptController::DoState(sw))
+  if (!DoStateSection(sw, "InterruptController", sections) || !InterruptController::DoState(sw))
     return false;
 
   g_gpu->RestoreDeviceContext();
-  if (!sw.DoMarker("GPU") || !g_gpu->DoState(sw, host_texture, update_display))
+  if (!DoStateSection(sw, "GPU", sections) || !g_gpu->DoState(sw, host_texture, update_display))
     return false;
 
-  if (!sw.DoMarker("CDROM") || !CDROM::DoState(sw))
+  if (!DoStateSection(sw, "CDROM", sections) || !CDROM::DoState(sw))
     return false;
 
-  if (!sw.DoMarker("Pad") || !Pad::DoState(sw, is_memory_state))
+  if (!DoStateSection(sw, "Pad", sections) || !Pad::DoState(sw, is_memory_state))
     return false;
 
-  if (!sw.DoMarker("Timers") || !Timers::DoState(sw))
+  if (!DoStateSection(sw, "Timers", sections) || !Timers::DoState(sw))
     return false;
 
-  if (!sw.DoMarker("SPU") || !SPU::DoState(sw))
+  if (!DoStateSection(sw, "SPU", sections) || !SPU::DoState(sw))
     return false;
 
-  if (!sw.DoMarker("MDEC") || !MDEC::DoState(sw))
+  if (!DoStateSection(sw, "MDEC", sections) || !MDEC::DoState(sw))
     return false;
 
-  if (!sw.DoMarker("SIO") || !SIO::DoState(sw))
+  if (!DoStateSection(sw, "SIO", sections) || !SIO::DoState(sw))
     return false;
 
-  if (!sw.DoMarker("Events") || !TimingEvents::DoState(sw))
+  if (!DoStateSection(sw, "Events", sections) || !TimingEvents::DoState(sw))
     return false;
 
-  if (!sw.DoMarker("Overclock"))
+  if (!DoStateSection(sw, "Overclock", sections))
     return false;
 
   bool cpu_overclock_active = g_settings.cpu_overclock_active;
@@ -2447,7 +2549,7 @@ bool System::DoState(StateWrapper& sw, GPUTexture** host_texture, bool update_di
   {
     if (sw.GetVersion() >= 56) [[unlikely]]
     {
-      if (!sw.DoMarker("Cheevos"))
+      if (!DoStateSection(sw, "Cheevos", sections))
         return false;
 
       if (!Achievements::DoState(sw))
@@ -2579,6 +2681,7 @@ bool System::LoadState(const char* path, Error* error, bool save_undo_state)
     return true;
   }
 
+  const FrameStatistics::ScopedStall stall(FrameStatistics::StallCause::SaveStateIO);
   Common::Timer load_timer;
 
   auto fp = FileSystem::OpenManagedCFile(path, "rb", error);
@@ -2711,49 +2814,127 @@ bool System::LoadStateFromBuffer(const SaveStateBuffer& buffer, Error* error, bo
   return true;
 }
 
-bool System::LoadStateBufferFromFile(SaveStateBuffer* buffer, std::FILE* fp, Error* error, bool read_title,
-                                     bool read_media_path, bool read_screenshot, bool read_data)
+bool System::ReadStateHeader(std::FILE* fp, SAVE_STATE_HEADER* header, s64* file_size, Error* error)
 {
-  const s64 file_size = FileSystem::FSize64(fp, error);
-  if (file_size < 0)
+  if ((*file_size = FileSystem::FSize64(fp, error)) < 0)
     return false;
 
   DebugAssert(FileSystem::FTell64(fp) == 0);
 
-  SAVE_STATE_HEADER header;
-  if (std::fread(&header, sizeof(header), 1, fp) != 1 || header.magic != SAVE_STATE_MAGIC) [[unlikely]]
+  // Older states have a shorter header, the data following it doesn't matter as long as the fields are ignored.
+  static constexpr size_t MIN_HEADER_SIZE = offsetof(SAVE_STATE_HEADER, num_sections);
+  std::memset(header, 0, sizeof(SAVE_STATE_HEADER));
+  if (std::fread(header, MIN_HEADER_SIZE, 1, fp) != 1 || header->magic != SAVE_STATE_MAGIC) [[unlikely]]
   {
     Error::SetErrno(error, "fread() for header failed: ", errno);
     return false;
   }
 
-  if (header.version < SAVE_STATE_MINIMUM_VERSION)
+  if (header->version < SAVE_STATE_MINIMUM_VERSION)
   {
     Error::SetStringFmt(
       error, TRANSLATE_FS("System", "Save state is incompatible: minimum version is {0} but state is version {1}."),
-      SAVE_STATE_MINIMUM_VERSION, header.version);
+      SAVE_STATE_MINIMUM_VERSION, header->version);
     return false;
   }
 
-  if (header.version > SAVE_STATE_VERSION)
+  if (header->version > SAVE_STATE_VERSION)
   {
     Error::SetStringFmt(
       error, TRANSLATE_FS("System", "Save state is incompatible: maximum version is {0} but state is version {1}."),
-      SAVE_STATE_VERSION, header.version);
+      SAVE_STATE_VERSION, header->version);
+    return false;
+  }
+
+  if (header->version >= 72 &&
+      std::fread(reinterpret_cast<u8*>(header) + MIN_HEADER_SIZE, sizeof(SAVE_STATE_HEADER) - MIN_HEADER_SIZE, 1,
+                 fp) != 1) [[unlikely]]
+  {
+    Error::SetErrno(error, "fread() for section header failed: ", errno);
     return false;
   }
 
   // Validate offsets.
-  if ((static_cast<s64>(header.offset_to_media_path) + header.media_path_length) > file_size ||
-      (static_cast<s64>(header.offset_to_screenshot) + header.screenshot_compressed_size) > file_size ||
-      header.screenshot_width >= 32768 || header.screenshot_height >= 32768 ||
-      (static_cast<s64>(header.offset_to_data) + header.data_compressed_size) > file_size ||
-      header.data_uncompressed_size > SAVE_STATE_HEADER::MAX_SAVE_STATE_SIZE) [[unlikely]]
+  if ((static_cast<s64>(header->offset_to_media_path) + header->media_path_length) > *file_size ||
+      (static_cast<s64>(header->offset_to_screenshot) + header->screenshot_compressed_size) > *file_size ||
+      header->screenshot_width >= 32768 || header->screenshot_height >= 32768 ||
+      (static_cast<s64>(header->offset_to_data) + header->data_compressed_size) > *file_size ||
+      header->data_uncompressed_size > SAVE_STATE_HEADER::MAX_SAVE_STATE_SIZE ||
+      header->num_sections > SAVE_STATE_HEADER::MAX_SECTIONS ||
+      (static_cast<s64>(header->offset_to_sections) +
+       static_cast<s64>(header->num_sections * sizeof(SAVE_STATE_SECTION_HEADER))) > *file_size) [[unlikely]]
   {
     Error::SetStringView(error, "Save state header is corrupted.");
     return false;
   }
 
+  return true;
+}
+
+bool System::ReadStateSectionTable(std::FILE* fp, const SAVE_STATE_HEADER& header, s64 file_size,
+                                   std::vector<SAVE_STATE_SECTION_HEADER>* sections, Error* error)
+{
+  sections->resize(header.num_sections);
+  if (header.num_sections == 0)
+    return true;
+
+  if (!FileSystem::FSeek64(fp, header.offset_to_sections, SEEK_SET, error)) [[unlikely]]
+    return false;
+
+  if (std::fread(sections->data(), sizeof(SAVE_STATE_SECTION_HEADER), sections->size(), fp) != sections->size())
+    [[unlikely]]
+  {
+    Error::SetErrno(error, "fread() for section table failed: ", errno);
+    return false;
+  }
+
+  for (SAVE_STATE_SECTION_HEADER& section : *sections)
+  {
+    section.name[SAVE_STATE_SECTION_HEADER::MAX_NAME_LENGTH - 1] = 0;
+    if ((static_cast<u64>(section.data_offset) + section.data_size) > header.data_uncompressed_size ||
+        (static_cast<s64>(section.offset_to_section) + section.compressed_size) > file_size) [[unlikely]]
+    {
+      Error::SetStringFmt(error, "Save state section '{}' is corrupted.", section.name);
+      return false;
+    }
+  }
+
+  // Sections are decompressed in parallel, so they must not overlap, and leaving gaps would hand uninitialized
+  // bytes to DoState(). Require that they exactly cover the state data.
+  std::stable_sort(sections->begin(), sections->end(),
+                   [](const SAVE_STATE_SECTION_HEADER& lhs, const SAVE_STATE_SECTION_HEADER& rhs) {
+                     return (lhs.data_offset < rhs.data_offset);
+                   });
+  u32 expected_offset = 0;
+  for (const SAVE_STATE_SECTION_HEADER& section : *sections)
+  {
+    if (section.data_offset != expected_offset) [[unlikely]]
+    {
+      Error::SetStringFmt(error, "Save state section '{}' overlaps or leaves a gap at offset {}.", section.name,
+                          expected_offset);
+      return false;
+    }
+
+    expected_offset += section.data_size;
+  }
+  if (expected_offset != header.data_uncompressed_size) [[unlikely]]
+  {
+    Error::SetStringFmt(error, "Save state sections cover {} of {} bytes.", expected_offset,
+                        header.data_uncompressed_size);
+    return false;
+  }
+
+  return true;
+}
+
+bool System::LoadStateBufferFromFile(SaveStateBuffer* buffer, std::FILE* fp, Error* error, bool read_title,
+                                     bool read_media_path, bool read_screenshot, bool read_data)
+{
+  SAVE_STATE_HEADER header;
+  s64 file_size;
+  if (!ReadStateHeader(fp, &header, &file_size, error))
+    return false;
+
   buffer->version = header.version;
 
   if (read_title)
@@ -2802,10 +2983,105 @@ bool System::LoadStateBufferFromFile(SaveStateBuffer* buffer, std::FILE* fp, Err
   {
     buffer->state_data.resize(header.data_uncompressed_size);
     buffer->state_size = header.data_uncompressed_size;
-    if (!ReadAndDecompressStateData(fp, buffer->state_data.span(), header.offset_to_data, header.data_compressed_size,
-                                    static_cast<SAVE_STATE_HEADER::CompressionType>(header.data_compression_type),
-                                    error)) [[unlikely]]
+    if (header.num_sections > 0)
+    {
+      std::vector<SAVE_STATE_SECTION_HEADER> sections;
+      if (!ReadStateSectionTable(fp, header, file_size, &sections, error) ||
+          !ReadAndDecompressStateSections(fp, buffer->state_data.span(), sections, error)) [[unlikely]]
+      {
+        return false;
+      }
+    }
+    else if (!ReadAndDecompressStateData(fp, buffer->state_data.span(), header.offset_to_data,
+                                         header.data_compressed_size,
+                                         static_cast<SAVE_STATE_HEADER::CompressionType>(header.data_compression_type),
+                                         error)) [[unlikely]]
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+bool System::ReadAndDecompressStateSections(std::FILE* fp, std::span<u8> dst,
+                                            std::span<const SAVE_STATE_SECTION_HEADER> sections, Error* error)
+{
+  // Read everything first, so the file access stays sequential.
+  size_t total_compressed_size = 0;
+  for (const SAVE_STATE_SECTION_HEADER& section : sections)
+  {
+    if (static_cast<SAVE_STATE_HEADER::CompressionType>(section.compression_type) !=
+        SAVE_STATE_HEADER::CompressionType::None)
+    {
+      total_compressed_size += section.compressed_size;
+    }
+  }
+
+  DynamicHeapArray<u8> compressed_data(total_compressed_size);
+  std::vector<std::span<const u8>> compressed_sections(sections.size());
+  size_t compressed_data_pos = 0;
+  for (size_t i = 0; i < sections.size(); i++)
+  {
+    const SAVE_STATE_SECTION_HEADER& section = sections[i];
+    const bool uncompressed = (static_cast<SAVE_STATE_HEADER::CompressionType>(section.compression_type) ==
+                               SAVE_STATE_HEADER::CompressionType::None);
+    const std::span<u8> read_dst = uncompressed ? dst.subspan(section.data_offset, section.data_size) :
+                                                  compressed_data.span(compressed_data_pos, section.compressed_size);
+    if (uncompressed && section.compressed_size != section.data_size) [[unlikely]]
+    {
+      Error::SetStringFmt(error, "Save state section '{}' is corrupted.", section.name);
+      return false;
+    }
+
+    if (!FileSystem::FSeek64(fp, section.offset_to_section, SEEK_SET, error)) [[unlikely]]
+      return false;
+    if (!read_dst.empty() && std::fread(read_dst.data(), read_dst.size(), 1, fp) != 1) [[unlikely]]
+    {
+      Error::SetErrno(error, "fread() for section failed: ", errno);
+      return false;
+    }
+
+    if (!uncompressed)
+    {
+      compressed_sections[i] = read_dst;
+      compressed_data_pos += section.compressed_size;
+    }
+  }
+
+  // RAM, VRAM and SPU RAM make up most of the state, decompress them in parallel with the rest.
+  static constexpr u32 PARALLEL_SECTION_SIZE = 256 * 1024;
+  TaskGroup tasks;
+  std::vector<Error> section_errors(sections.size());
+  std::unique_ptr<bool[]> section_results = std::make_unique<bool[]>(sections.size());
+  for (size_t i = 0; i < sections.size(); i++)
+  {
+    const SAVE_STATE_SECTION_HEADER& section = sections[i];
+    section_results[i] = true;
+    if (compressed_sections[i].empty())
+      continue;
+
+    const auto decompress = [&sections, &compressed_sections, &section_errors, &section_results, dst, i]() {
+      const SAVE_STATE_SECTION_HEADER& section = sections[i];
+      section_results[i] =
+        DecompressStateData(dst.subspan(section.data_offset, section.data_size), compressed_sections[i],
+                            static_cast<SAVE_STATE_HEADER::CompressionType>(section.compression_type),
+                            &section_errors[i]);
+    };
+    if (section.data_size >= PARALLEL_SECTION_SIZE)
+      tasks.Submit(decompress, TaskScheduler::Priority::High);
+    else
+      decompress();
+  }
+
+  tasks.Wait();
+
+  for (size_t i = 0; i < sections.size(); i++)
+  {
+    if (!section_results[i]) [[unlikely]]
     {
+      Error::SetStringFmt(error, "Failed to decompress section '{}': {}", sections[i].name,
+                          section_errors[i].GetDescription());
       return false;
     }
   }
@@ -2813,6 +3089,44 @@ bool System::LoadStateBufferFromFile(SaveStateBuffer* buffer, std::FILE* fp, Err
   return true;
 }
 
+bool System::ReadSaveStateSection(const char* path, std::string_view name, std::vector<u8>* data, u32* version,
+                                  Error* error)
+{
+  auto fp = FileSystem::OpenManagedCFile(path, "rb", error);
+  if (!fp)
+    return false;
+
+  SAVE_STATE_HEADER header;
+  s64 file_size;
+  std::vector<SAVE_STATE_SECTION_HEADER> sections;
+  if (!ReadStateHeader(fp.get(), &header, &file_size, error) ||
+      !ReadStateSectionTable(fp.get(), header, file_size, &sections, error))
+  {
+    return false;
+  }
+
+  if (header.num_sections == 0)
+  {
+    Error::SetStringFmt(error, "Save state version {} does not have a section table.", header.version);
+    return false;
+  }
+
+  for (const SAVE_STATE_SECTION_HEADER& section : sections)
+  {
+    if (name != section.name)
+      continue;
+
+    data->resize(section.data_size);
+    *version = header.version;
+    return ReadAndDecompressStateData(fp.get(), std::span<u8>(*data), section.offset_to_section,
+                                      section.compressed_size,
+                                      static_cast<SAVE_STATE_HEADER::CompressionType>(section.compression_type), error);
+  }
+
+  Error::SetStringFmt(error, "Save state does not contain a '{}' section.", name);
+  return false;
+}
+
 bool System::ReadAndDecompressStateData(std::FILE* fp, std::span<u8> dst, u32 file_offset, u32 compressed_size,
                                         SAVE_STATE_HEADER::CompressionType method, Error* error)
 {
@@ -2838,11 +3152,18 @@ bool System::ReadAndDecompressStateData(std::FILE* fp, std::span<u8> dst, u32 fi
     return false;
   }
 
+  return DecompressStateData(dst, compressed_data.cspan(), method, error);
+}
+
+bool System::DecompressStateData(std::span<u8> dst, std::span<const u8> src, SAVE_STATE_HEADER::CompressionType method,
+                                 Error* error)
+{
+  const u32 compressed_size = static_cast<u32>(src.size());
   if (method == SAVE_STATE_HEADER::CompressionType::Deflate)
   {
     uLong source_len = compressed_size;
     uLong dest_len = static_cast<uLong>(dst.size());
-    const int err = uncompress2(dst.data(), &dest_len, compressed_data.data(), &source_len);
+    const int err = uncompress2(dst.data(), &dest_len, src.data(), &source_len);
     if (err != Z_OK) [[unlikely]]
     {
       Error::SetStringFmt(error, "uncompress2() failed: ", err);
@@ -2861,7 +3182,7 @@ bool System::ReadAndDecompressStateData(std::FILE* fp, std::span<u8> dst, u32 fi
   }
   else if (method == SAVE_STATE_HEADER::CompressionType::Zstandard)
   {
-    const size_t result = ZSTD_decompress(dst.data(), dst.size(), compressed_data.data(), compressed_size);
+    const size_t result = ZSTD_decompress(dst.data(), dst.size(), src.data(), compressed_size);
     if (ZSTD_isError(result)) [[unlikely]]
     {
       const char* errstr = ZSTD_getErrorString(ZSTD_getErrorCode(result));
@@ -2891,6 +3212,7 @@ bool System::SaveState(const char* path, Error* error, bool backup_existing_save
     return false;
   }
 
+  const FrameStatistics::ScopedStall stall(FrameStatistics::StallCause::SaveStateIO);
   Common::Timer save_timer;
 
   SaveStateBuffer buffer;
@@ -3003,8 +3325,9 @@ bool System::SaveStateToBuffer(SaveStateBuffer* buffer, Error* error, u32 screen
     buffer->state_data.resize(GetMaxSaveStateSize());
 
   g_gpu->RestoreDeviceContext();
+  buffer->sections.clear();
   StateWrapper sw(buffer->state_data.span(), StateWrapper::Mode::Write, SAVE_STATE_VERSION);
-  if (!DoState(sw, nullptr, false, false))
+  if (!DoState(sw, nullptr, false, false, &buffer->sections))
   {
     Error::SetStringView(error, "DoState() failed");
     return false;
@@ -3062,17 +3385,51 @@ bool System::SaveStateBufferToFile(const SaveStateBuffer& buffer, std::FILE* fp,
     file_position += header.screenshot_compressed_size;
   }
 
-  DebugAssert(buffer.state_size > 0);
+  // Each section is compressed separately, so they can be decompressed in parallel, or read on their own.
+  DebugAssert(buffer.state_size > 0 && !buffer.sections.empty() &&
+              buffer.sections.size() <= SAVE_STATE_HEADER::MAX_SECTIONS);
   header.offset_to_data = file_position;
   header.data_uncompressed_size = static_cast<u32>(buffer.state_size);
-  header.data_compressed_size = CompressAndWriteStateData(fp, buffer.state_data.cspan(0, buffer.state_size),
-                                                          compression, &header.data_compression_type, error);
-  if (header.data_compressed_size == 0)
+  header.data_compressed_size = 0;
+
+  std::array<SAVE_STATE_SECTION_HEADER, SAVE_STATE_HEADER::MAX_SECTIONS> section_headers = {};
+  for (size_t i = 0; i < buffer.sections.size(); i++)
+  {
+    // Anything before the first marker belongs to the first section.
+    const u32 start = (i == 0) ? 0 : buffer.sections[i].offset;
+    const u32 end =
+      (i == (buffer.sections.size() - 1)) ? static_cast<u32>(buffer.state_size) : buffer.sections[i + 1].offset;
+
+    DebugAssert(FileSystem::FTell64(fp) == static_cast<s64>(file_position));
+    SAVE_STATE_SECTION_HEADER& sh = section_headers[i];
+    StringUtil::Strlcpy(sh.name, buffer.sections[i].name, sizeof(sh.name));
+    sh.data_offset = start;
+    sh.data_size = end - start;
+    sh.offset_to_section = file_position;
+    sh.compressed_size =
+      CompressAndWriteStateData(fp, buffer.state_data.cspan(start, end - start), compression, &sh.compression_type,
+                                error);
+    if (sh.compressed_size == 0)
+      return false;
+
+    file_position += sh.compressed_size;
+    header.data_compressed_size += sh.compressed_size;
+  }
+  header.data_compression_type = section_headers[0].compression_type;
+
+  DebugAssert(FileSystem::FTell64(fp) == static_cast<s64>(file_position));
+  header.num_sections = static_cast<u32>(buffer.sections.size());
+  header.offset_to_sections = file_position;
+  if (std::fwrite(section_headers.data(), sizeof(SAVE_STATE_SECTION_HEADER), header.num_sections, fp) !=
+      header.num_sections)
+  {
+    Error::SetErrno(error, "fwrite() for section table failed: ", errno);
     return false;
+  }
 
-  INFO_LOG("Save state compression: screenshot {} => {} bytes, data {} => {} bytes",
+  INFO_LOG("Save state compression: screenshot {} => {} bytes, data {} => {} bytes in {} sections",
            buffer.screenshot.GetPitch() * buffer.screenshot.GetHeight(), header.screenshot_compressed_size,
-           buffer.state_size, header.data_compressed_size);
+           buffer.state_size, header.data_compressed_size, header.num_sections);
 
   if (!FileSystem::FSeek64(fp, 0, SEEK_SET, error))
     return false;
@@ -3177,6 +3534,12 @@ void System::UpdatePerformanceCounters()
   s_frame_time_history[s_frame_time_history_pos] = frame_time;
   s_frame_time_history_pos = (s_frame_time_history_pos + 1) % NUM_FRAME_TIME_SAMPLES;
 
+  // Unthrottled frames are judged against the console's refresh rate instead.
+  const float frame_budget = (s_frame_period > 1) ?
+                               static_cast<float>(Common::Timer::ConvertValueToMilliseconds(s_frame_period)) :
+                               (1000.0f / s_throttle_frequency);
+  FrameStatistics::EndFrame(s_frame_number, frame_time, frame_budget);
+
   // update fps counter
   const Common::Timer::Value now_ticks = Common::Timer::GetCurrentValue();
   const Common::Timer::Value ticks_diff = now_ticks - s_fps_timer.GetStartValue();
@@ -3218,6 +3581,7 @@ void System::UpdatePerformanceCounters()
 
   s_cpu_thread_usage = static_cast<float>(static_cast<double>(cpu_delta) * pct_divider);
   s_cpu_thread_time = static_cast<float>(static_cast<double>(cpu_delta) * time_divider);
+  s_cpu_thread_processor = Threading::GetCurrentProcessorIndex();
   s_sw_thread_usage = static_cast<float>(static_cast<double>(sw_delta) * pct_divider);
   s_sw_thread_time = static_cast<float>(static_cast<double>(sw_delta) * time_divider);
 
@@ -3234,14 +3598,32 @@ void System::UpdatePerformanceCounters()
   s_accumulated_gpu_time = 0.0f;
   s_presents_since_last_update = 0;
 
+  s_input_latency = s_accumulated_input_latency / static_cast<float>(std::max(s_input_latency_samples, 1u));
+  s_accumulated_input_latency = 0.0f;
+  s_input_latency_samples = 0;
+
+  const InputManager::EventStatistics input_stats = InputManager::GetEventStatistics();
+  InputManager::ResetEventStatistics();
+  s_average_input_dispatch_time =
+    static_cast<float>(Common::Timer::ConvertValueToNanoseconds(input_stats.total_time) /
+                       (static_cast<double>(std::max<u64>(input_stats.num_events, 1)) * 1000.0));
+  s_maximum_input_dispatch_time =
+    static_cast<float>(Common::Timer::ConvertValueToNanoseconds(input_stats.max_time) / 1000.0);
+  s_average_input_read_latency =
+    static_cast<float>(Common::Timer::ConvertValueToMilliseconds(input_stats.total_read_latency) /
+                       static_cast<double>(std::max<u64>(input_stats.num_reads, 1)));
+  s_maximum_input_read_latency =
+    static_cast<float>(Common::Timer::ConvertValueToMilliseconds(input_stats.max_read_latency));
+
   if (g_settings.display_show_gpu_stats)
     g_gpu->UpdateStatistics(frames_run);
 
-  if (s_pre_frame_sleep)
-    UpdatePreFrameSleepTime();
+  FrameStatistics::UpdateSummary();
 
-  VERBOSE_LOG("FPS: {:.2f} VPS: {:.2f} CPU: {:.2f} GPU: {:.2f} Average: {:.2f}ms Min: {:.2f}ms Max: {:.2f}ms", s_fps,
-              s_vps, s_cpu_thread_usage, s_gpu_usage, s_average_frame_time, s_minimum_frame_time, s_maximum_frame_time);
+  VERBOSE_LOG("FPS: {:.2f} VPS: {:.2f} CPU: {:.2f} (processor {}) GPU: {:.2f} Average: {:.2f}ms Min: {:.2f}ms "
+              "Max: {:.2f}ms",
+              s_fps, s_vps, s_cpu_thread_usage, s_cpu_thread_processor, s_gpu_usage, s_average_frame_time,
+              s_minimum_frame_time, s_maximum_frame_time);
 
   Host::OnPerformanceCountersUpdated();
 }
@@ -3265,38 +3647,87 @@ void System::ResetPerformanceCounters()
   ResetThrottler();
 }
 
-void System::AccumulatePreFrameSleepTime()
+void System::UpdateThreadPlacement()
 {
-  DebugAssert(s_pre_frame_sleep);
+  const Threading::ProcessorTopology& topology = Threading::GetProcessorTopology();
+  const u64 startup_mask = topology.all_mask & s_startup_affinity_mask;
+  const u64 available_mask = startup_mask ? startup_mask : topology.all_mask;
+  const u64 performance_mask = topology.performance_mask & available_mask;
+
+  u64 cpu_mask = 0;
+  u64 helper_mask = 0;
+  bool placing = true;
+  if (g_settings.thread_placement == ThreadPlacementMode::Pinned)
+  {
+    s32 cpu_processor = -1;
+    if (g_settings.cpu_thread_processor >= 0)
+    {
+      if (topology.all_mask & (static_cast<u64>(1) << g_settings.cpu_thread_processor))
+        cpu_processor = g_settings.cpu_thread_processor;
+      else
+        WARNING_LOG("Processor {} is not available, choosing automatically.", g_settings.cpu_thread_processor);
+    }
 
-  s_max_active_frame_time = std::max(s_max_active_frame_time, s_last_active_frame_time);
+    // Take the last performance core, the first ones tend to service more interrupts.
+    if (cpu_processor < 0)
+      cpu_processor = 63 - static_cast<s32>(CountLeadingZeros(performance_mask ? performance_mask : available_mask));
 
-  // in case one frame runs over, adjust to compensate
-  const Common::Timer::Value max_sleep_time_for_this_frame =
-    s_frame_period - std::min(s_last_active_frame_time, s_frame_period);
-  if (max_sleep_time_for_this_frame < s_pre_frame_sleep_time)
+    cpu_mask = static_cast<u64>(1) << cpu_processor;
+    helper_mask = available_mask & ~topology.sibling_masks[cpu_processor];
+    helper_mask = helper_mask ? helper_mask : available_mask;
+    INFO_LOG("Pinning CPU thread to {} processor {}, helper threads on {:016X}.",
+             (topology.performance_mask & cpu_mask) ? "performance" : "efficiency", cpu_processor, helper_mask);
+  }
+  else if (g_settings.thread_placement == ThreadPlacementMode::Automatic && topology.IsHeterogeneous() &&
+           performance_mask != 0 && performance_mask != available_mask)
   {
-    s_pre_frame_sleep_time = Common::AlignDown(max_sleep_time_for_this_frame,
-                                               static_cast<unsigned int>(Common::Timer::ConvertMillisecondsToValue(1)));
-    DEV_LOG("Adjust pre-frame time to {} ms due to overrun of {} ms",
-            Common::Timer::ConvertValueToMilliseconds(s_pre_frame_sleep_time),
-            Common::Timer::ConvertValueToMilliseconds(s_last_active_frame_time));
+    // Only keep the CPU thread off the efficiency cores. Leaving the choice of performance core to the OS means that
+    // several instances on the same host don't all end up on one core. Homogeneous systems are left alone entirely.
+    cpu_mask = performance_mask;
+    helper_mask = available_mask;
+    INFO_LOG("Placing CPU thread on performance processors {:016X}.", cpu_mask);
   }
+  else
+  {
+    // Don't override affinity set from outside (e.g. taskset) unless we changed it ourselves.
+    if (!s_thread_placement_active)
+      return;
+
+    // Zero means all processors, for when we couldn't find out what we were started with.
+    cpu_mask = s_startup_affinity_mask;
+    helper_mask = s_startup_affinity_mask;
+    placing = false;
+    INFO_LOG("Thread placement disabled, restoring startup affinity {:016X}.", s_startup_affinity_mask);
+  }
+
+  if (s_cpu_thread_handle && !s_cpu_thread_handle.SetAffinity(cpu_mask))
+    WARNING_LOG("Failed to set CPU thread affinity to {:016X}", cpu_mask);
+  if (const Threading::Thread* sw_thread = g_gpu ? g_gpu->GetSWThread() : nullptr)
+    sw_thread->SetAffinity(helper_mask);
+  if (const Threading::Thread* read_thread = CDROM::GetReadThread())
+    read_thread->SetAffinity(helper_mask);
+  TaskScheduler::SetAffinityMask(helper_mask);
+
+  s_thread_placement_active = placing;
 }
 
-void System::UpdatePreFrameSleepTime()
+void System::UpdatePreFrameSleepTime(Common::Timer::Value current_time)
 {
   DebugAssert(s_pre_frame_sleep);
 
-  const Common::Timer::Value expected_frame_time =
-    s_max_active_frame_time + Common::Timer::ConvertMillisecondsToValue(g_settings.display_pre_frame_sleep_buffer);
-  s_pre_frame_sleep_time = Common::AlignDown(s_frame_period - std::min(expected_frame_time, s_frame_period),
-                                             static_cast<unsigned int>(Common::Timer::ConvertMillisecondsToValue(1)));
-  DEV_LOG("Set pre-frame time to {} ms (expected frame time of {} ms)",
-          Common::Timer::ConvertValueToMilliseconds(s_pre_frame_sleep_time),
-          Common::Timer::ConvertValueToMilliseconds(expected_frame_time));
+  // Games often have very different costs between FMVs, menus and gameplay, which usually use different display modes.
+  s_frame_pacer.SetPhase(g_gpu->GetDisplayModeKey());
+  s_frame_pacer.AddFrame(s_last_active_frame_time, s_frame_period, current_time > s_next_frame_time);
 
-  s_max_active_frame_time = 0;
+  const Common::Timer::Value new_sleep_time = s_frame_pacer.GetSleepTime(
+    s_frame_period, Common::Timer::ConvertMillisecondsToValue(g_settings.display_pre_frame_sleep_buffer));
+  if (new_sleep_time != s_pre_frame_sleep_time)
+  {
+    DEBUG_LOG("Set pre-frame time to {} ms (predicted frame time of {:.2f} ms)",
+              Common::Timer::ConvertValueToMilliseconds(new_sleep_time),
+              Common::Timer::ConvertValueToMilliseconds(s_frame_pacer.GetPredictedActiveTime()));
+    s_pre_frame_sleep_time = new_sleep_time;
+  }
 }
 
 void System::FormatLatencyStats(SmallStringBase& str)
@@ -3307,12 +3738,32 @@ void System::FormatLatencyStats(SmallStringBase& str)
 
   const double active_frame_time = std::ceil(Common::Timer::ConvertValueToMilliseconds(s_last_active_frame_time));
   const double pre_frame_time = std::ceil(Common::Timer::ConvertValueToMilliseconds(s_pre_frame_sleep_time));
-  const double input_latency = std::ceil(
-    Common::Timer::ConvertValueToMilliseconds(s_frame_period - s_pre_frame_sleep_time) -
-    Common::Timer::ConvertValueToMilliseconds(static_cast<Common::Timer::Value>(s_runahead_frames) * s_frame_period));
+  const double input_latency = std::ceil(std::max(
+    static_cast<double>(s_input_latency) -
+      Common::Timer::ConvertValueToMilliseconds(static_cast<Common::Timer::Value>(s_runahead_frames) * s_frame_period),
+    0.0));
 
   str.format("AF: {:.0f}ms | PF: {:.0f}ms | IL: {:.0f}ms | AL: {}ms", active_frame_time, pre_frame_time, input_latency,
              audio_latency);
+  if (s_pre_frame_sleep)
+    str.append_format(" | MR: {:.1f}%", s_frame_pacer.GetMissRate() * 100.0f);
+  str.append_format(" | ID: {:.1f}/{:.1f}us", s_average_input_dispatch_time, s_maximum_input_dispatch_time);
+  str.append_format(" | RL: {:.1f}/{:.1f}ms", s_average_input_read_latency, s_maximum_input_read_latency);
+}
+
+void System::PollInputForControllerRead()
+{
+  // Runahead replays frames from saved states, polling in the middle of those would make the replay diverge.
+  if (g_settings.input_polling_rate > 0 && s_runahead_frames == 0)
+  {
+    const Common::Timer::Value current_time = Common::Timer::GetCurrentValue();
+    const Common::Timer::Value interval =
+      Common::Timer::ConvertSecondsToValue(1.0 / static_cast<double>(g_settings.input_polling_rate));
+    if ((current_time - InputManager::GetLastPollTime()) >= interval)
+      InputManager::PollSourcesForSubFrame();
+  }
+
+  InputManager::RecordControllerRead();
 }
 
 void System::UpdateSpeedLimiterState()
@@ -3326,6 +3777,7 @@ void System::UpdateSpeedLimiterState()
   s_optimal_frame_pacing = (s_throttler_enabled && g_settings.display_optimal_frame_pacing);
   s_skip_presenting_duplicate_frames = s_throttler_enabled && g_settings.display_skip_presenting_duplicate_frames;
   s_pre_frame_sleep = s_optimal_frame_pacing && g_settings.display_pre_frame_sleep;
+  s_frame_pacer.SetTargetMissRate(g_settings.display_pre_frame_sleep_miss_rate / 100.0f);
   s_can_sync_to_host = false;
   s_syncing_to_host = false;
   s_syncing_to_host_with_vsync = false;
@@ -4389,6 +4841,7 @@ void System::CheckForSettingsChanges(const Settings& old_settings)
         g_settings.display_skip_presenting_duplicate_frames != old_settings.display_skip_presenting_duplicate_frames ||
         g_settings.display_pre_frame_sleep != old_settings.display_pre_frame_sleep ||
         g_settings.display_pre_frame_sleep_buffer != old_settings.display_pre_frame_sleep_buffer ||
+        g_settings.display_pre_frame_sleep_miss_rate != old_settings.display_pre_frame_sleep_miss_rate ||
         g_settings.display_vsync != old_settings.display_vsync ||
         g_settings.display_disable_mailbox_presentation != old_settings.display_disable_mailbox_presentation ||
         g_settings.sync_to_host_refresh_rate != old_settings.sync_to_host_refresh_rate)
@@ -4481,6 +4934,14 @@ void System::CheckForSettingsChanges(const Settings& old_settings)
   }
 #endif
 
+  if (g_settings.telemetry_enable != old_settings.telemetry_enable ||
+      g_settings.telemetry_ram_regions != old_settings.telemetry_ram_regions)
+  {
+    SharedTelemetry::Shutdown();
+    if (g_settings.telemetry_enable)
+      SharedTelemetry::Initialize(g_settings.telemetry_ram_regions);
+  }
+
   if (g_settings.export_shared_memory != old_settings.export_shared_memory) [[unlikely]]
   {
     Error error;
@@ -4491,11 +4952,15 @@ void System::CheckForSettingsChanges(const Settings& old_settings)
     }
   }
 
+  // Threads may have been restarted above, so this needs to happen even if the placement settings didn't change.
+  if (IsValid())
+    UpdateThreadPlacement();
+
   if (g_settings.log_level != old_settings.log_level || g_settings.log_filter != old_settings.log_filter ||
       g_settings.log_timestamps != old_settings.log_timestamps ||
       g_settings.log_to_console != old_settings.log_to_console ||
       g_settings.log_to_debug != old_settings.log_to_debug || g_settings.log_to_window != old_settings.log_to_window ||
-      g_settings.log_to_file != old_settings.log_to_file)
+      g_settings.log_to_file != old_settings.log_to_file || g_settings.log_async != old_settings.log_async)
   {
     g_settings.UpdateLogSettings();
   }
@@ -4646,11 +5111,11 @@ void System::UpdateMemorySaveStateSettings()
     INFO_LOG("Runahead is active with {} frames", s_runahead_frames);
 }
 
-bool System::LoadMemoryState(const MemorySaveState& mss)
+bool System::LoadMemoryState(const MemorySaveState& mss, bool update_display)
 {
   StateWrapper sw(mss.state_data.cspan(), StateWrapper::Mode::Read, SAVE_STATE_VERSION);
   GPUTexture* host_texture = mss.vram_texture.get();
-  if (!DoState(sw, &host_texture, true, true)) [[unlikely]]
+  if (!DoState(sw, &host_texture, update_display, true)) [[unlikely]]
   {
     Host::ReportErrorAsync("Error", "Failed to load memory save state, resetting.");
     ResetSystem();
@@ -4726,7 +5191,7 @@ bool System::LoadRewindState(u32 skip_saves /*= 0*/, bool consume_state /*=true
   Common::Timer load_timer;
 #endif
 
-  if (!LoadMemoryState(s_rewind_states.back()))
+  if (!LoadMemoryState(s_rewind_states.back(), true))
     return false;
 
   if (consume_state)
@@ -4820,9 +5285,9 @@ bool System::DoRunahead()
     replay_timer.Reset();
 #endif
 
-    // we need to replay and catch up - load the state,
+    // we need to replay and catch up - load the state, no need to update the display since it won't be shown
     s_runahead_replay_pending = false;
-    if (s_runahead_states.empty() || !LoadMemoryState(s_runahead_states.front()))
+    if (s_runahead_states.empty() || !LoadMemoryState(s_runahead_states.front(), false))
     {
       s_runahead_states.clear();
       return false;
@@ -4874,6 +5339,12 @@ bool System::DoRunahead()
   return false;
 }
 
+bool System::IsRunaheadReplayFrame()
+{
+  // The last frame of the replay is the one that gets presented.
+  return (s_runahead_replay_frames > 1);
+}
+
 void System::SetRunaheadReplayFlag()
 {
   if (s_runahead_frames == 0 || s_runahead_states.empty())
@@ -5024,6 +5495,38 @@ bool System::SaveScreenshot(const char* filename, DisplayScreenshotMode mode, Di
   return g_gpu->RenderScreenshotToFile(filename, mode, quality, compress_on_thread, true);
 }
 
+bool System::ExportFrameStatistics()
+{
+  if (!System::IsValid())
+    return false;
+
+  const std::string sanitized_name = Path::SanitizeFileName(System::GetGameTitle());
+  const TinyString timestamp = GetTimestampStringForFileName();
+  const std::string basename =
+    Path::Combine(EmuFolders::Dumps, sanitized_name.empty() ?
+                                       fmt::format("frametimes {}", timestamp) :
+                                       fmt::format("{} frametimes {}", sanitized_name, timestamp));
+  const std::string csv_path = basename + ".csv";
+  const std::string json_path = basename + ".json";
+
+  Error error;
+  if (!FrameStatistics::ExportCSV(csv_path.c_str(), &error) || !FrameStatistics::ExportJSON(json_path.c_str(), &error))
+  {
+    ERROR_LOG("Failed to export frame statistics: {}", error.GetDescription());
+    Host::AddIconOSDMessage("ExportFrameStatistics", ICON_EMOJI_WARNING,
+                            fmt::format(TRANSLATE_FS("System", "Failed to export frame statistics: {}"),
+                                        error.GetDescription()),
+                            Host::OSD_ERROR_DURATION);
+    return false;
+  }
+
+  Host::AddIconOSDMessage("ExportFrameStatistics", ICON_EMOJI_INFORMATION,
+                          fmt::format(TRANSLATE_FS("System", "Frame statistics exported to '{}'."),
+                                      Path::GetFileName(csv_path)),
+                          Host::OSD_INFO_DURATION);
+  return true;
+}
+
 static std::string_view GetCaptureTypeForMessage(bool capture_video, bool capture_audio)
 {
   return capture_video ? (capture_audio ? TRANSLATE_SV("System", "capturing audio and video") :
@@ -5647,6 +6150,8 @@ void System::HostDisplayResized()
 
 bool System::PresentDisplay(bool skip_present, bool explicit_present)
 {
+  const Common::Timer::Value start_time = Common::Timer::GetCurrentValue();
+
   // acquire for IO.MousePos.
   std::atomic_thread_fence(std::memory_order_acquire);
 
@@ -5673,7 +6178,15 @@ bool System::PresentDisplay(bool skip_present, bool explicit_present)
   if (do_present)
   {
     g_gpu_device->RenderImGui();
+
+    const Common::Timer::Value present_start_time = Common::Timer::GetCurrentValue();
     g_gpu_device->EndPresent(explicit_present);
+    if (s_state == State::Running)
+    {
+      FrameStatistics::AddPhaseTime(FrameStatistics::Phase::GPUSubmit, present_start_time - start_time);
+      FrameStatistics::AddPhaseTime(FrameStatistics::Phase::Present,
+                                    Common::Timer::GetCurrentValue() - present_start_time);
+    }
 
     if (g_gpu_device->IsGPUTimingEnabled())
     {
@@ -5746,9 +6259,15 @@ SocketMultiplexer* System::GetSocketMultiplexer()
   Error error;
   s_socket_multiplexer = SocketMultiplexer::Create(&error);
   if (s_socket_multiplexer)
+  {
+    // Keep socket system calls off the CPU thread, we only pick up the results when polling.
+    s_socket_multiplexer->StartIOThread();
     INFO_LOG("Created socket multiplexer.");
+  }
   else
+  {
     ERROR_LOG("Failed to create socket multiplexer: {}", error.GetDescription());
+  }
 
   return s_socket_multiplexer.get();
 #else
@@ -223,6 +223,8 @@ float GetMaximumFrameTime();
 float GetThrottleFrequency();
 float GetCPUThreadUsage();
 float GetCPUThreadAverageTime();
+/// Returns the processor the CPU thread was last seen running on, or -1 if unknown.
+s32 GetCPUThreadProcessor();
 float GetSWThreadUsage();
 float GetSWThreadAverageTime();
 float GetGPUUsage();
@@ -231,6 +233,10 @@ const FrameTimeHistory& GetFrameTimeHistory();
 u32 GetFrameTimeHistoryPos();
 void FormatLatencyStats(SmallStringBase& str);
 
+/// Called when the guest begins a controller transfer. Polls the input sources again if the sub-frame polling
+/// interval has elapsed, so the controller state read by the game is as fresh as possible.
+void PollInputForControllerRead();
+
 /// Loads global settings (i.e. EmuConfig).
 void LoadSettings(bool display_osd_messages);
 void SetDefaultSettings(SettingsInterface& si);
@@ -283,7 +289,7 @@ void SwapMemoryCards();
 /// Dumps RAM to a file.
 bool DumpRAM(const char* filename);
 
-/// Dumps video RAM to a file.
+/// Dumps video RAM to a file. PNG dumps are written asynchronously, true only means the dump was queued.
 bool DumpVRAM(const char* filename);
 
 /// Dumps sound RAM to a file.
@@ -375,6 +381,9 @@ std::optional<SaveStateInfo> GetSaveStateInfo(const char* serial, s32 slot);
 /// Returns save state info from opened save state stream.
 std::optional<ExtendedSaveStateInfo> GetExtendedSaveStateInfo(const char* path);
 
+/// Reads and decompresses a single section of a save state, e.g. "Bus" for RAM, without loading the rest.
+bool ReadSaveStateSection(const char* path, std::string_view name, std::vector<u8>* data, u32* version, Error* error);
+
 /// Deletes save states for the specified game code. If resume is set, the resume state is deleted too.
 void DeleteSaveStates(const char* serial, bool resume);
 
@@ -391,6 +400,9 @@ bool SaveScreenshot(const char* filename = nullptr, DisplayScreenshotMode mode =
                     DisplayScreenshotFormat format = g_settings.display_screenshot_format,
                     u8 quality = g_settings.display_screenshot_quality, bool compress_on_thread = true);
 
+/// Writes the per-frame timing history to CSV and JSON files in the dumps directory.
+bool ExportFrameStatistics();
+
 #ifndef __ANDROID__
 
 /// Returns the path that a new media capture would be saved to by default. Safe to call from any thread.
@@ -458,6 +470,10 @@ void CalculateRewindMemoryUsage(u32 num_saves, u32 resolution_scale, u64* ram_us
 void ClearMemorySaveStates();
 void SetRunaheadReplayFlag();
 
+/// Returns true if the current frame is a runahead catch-up frame, which will not be displayed.
+/// Only emulated state matters for these frames, any host-side output work can be skipped.
+bool IsRunaheadReplayFrame();
+
 /// Shared socket multiplexer, used by PINE/GDB/etc.
 SocketMultiplexer* GetSocketMultiplexer();
 void ReleaseSocketMultiplexer();
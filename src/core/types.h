@@ -275,3 +275,12 @@ enum class SaveStateCompressionMode : u8
 
   Count,
 };
+
+enum class ThreadPlacementMode : u8
+{
+  Disabled,
+  Automatic,
+  Pinned,
+
+  Count,
+};
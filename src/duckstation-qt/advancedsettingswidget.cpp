@@ -271,6 +271,15 @@ void AdvancedSettingsWidget::addTweakOptions()
   addBooleanTweakOption(m_dialog, m_ui.tweakOptionTable, tr("Enable PINE"), "PINE", "Enabled", false);
   addIntRangeTweakOption(m_dialog, m_ui.tweakOptionTable, tr("PINE Slot"), "PINE", "Slot", 0, 65535,
                          Settings::DEFAULT_PINE_SLOT);
+  addBooleanTweakOption(m_dialog, m_ui.tweakOptionTable, tr("Export Telemetry"), "Telemetry", "Enabled", false);
+  addChoiceTweakOption(m_dialog, m_ui.tweakOptionTable, tr("Thread Placement"), "Main", "ThreadPlacement",
+                       &Settings::ParseThreadPlacementModeName, &Settings::GetThreadPlacementModeName,
+                       &Settings::GetThreadPlacementModeDisplayName, static_cast<u32>(ThreadPlacementMode::Count),
+                       Settings::DEFAULT_THREAD_PLACEMENT_MODE);
+  addIntRangeTweakOption(m_dialog, m_ui.tweakOptionTable, tr("CPU Thread Processor"), "Main", "CPUThreadProcessor",
+                         -1, 63, -1);
+  addIntRangeTweakOption(m_dialog, m_ui.tweakOptionTable, tr("Sub-Frame Input Polling Rate (Hz)"), "Main",
+                         "InputPollingRate", 0, 8000, 0);
 
   addBooleanTweakOption(m_dialog, m_ui.tweakOptionTable, tr("Enable PCDrv"), "PCDrv", "Enabled", false);
   addBooleanTweakOption(m_dialog, m_ui.tweakOptionTable, tr("Enable PCDrv Writes"), "PCDrv", "EnableWrites", false);
@@ -308,6 +317,10 @@ void AdvancedSettingsWidget::onResetToDefaultClicked()
     setBooleanTweakOption(m_ui.tweakOptionTable, i++, false);                        // Export Shared Memory
     setBooleanTweakOption(m_ui.tweakOptionTable, i++, false);                        // Enable PINE
     setIntRangeTweakOption(m_ui.tweakOptionTable, i++, Settings::DEFAULT_PINE_SLOT); // PINE Slot
+    setBooleanTweakOption(m_ui.tweakOptionTable, i++, false);                        // Export Telemetry
+    setChoiceTweakOption(m_ui.tweakOptionTable, i++, Settings::DEFAULT_THREAD_PLACEMENT_MODE); // Thread Placement
+    setIntRangeTweakOption(m_ui.tweakOptionTable, i++, -1);                          // CPU Thread Processor
+    setIntRangeTweakOption(m_ui.tweakOptionTable, i++, 0);                           // Input Polling Rate
     setBooleanTweakOption(m_ui.tweakOptionTable, i++, false);                        // Enable PCDRV
     setBooleanTweakOption(m_ui.tweakOptionTable, i++, false);                        // Enable PCDRV Writes
     setDirectoryOption(m_ui.tweakOptionTable, i++, "");                              // PCDrv Root Directory
@@ -338,6 +351,10 @@ void AdvancedSettingsWidget::onResetToDefaultClicked()
   sif->DeleteValue("CDROM", "AllowBootingWithoutSBIFile");
   sif->DeleteValue("PINE", "Enabled");
   sif->DeleteValue("PINE", "Slot");
+  sif->DeleteValue("Telemetry", "Enabled");
+  sif->DeleteValue("Main", "ThreadPlacement");
+  sif->DeleteValue("Main", "CPUThreadProcessor");
+  sif->DeleteValue("Main", "InputPollingRate");
   sif->DeleteValue("PCDrv", "Enabled");
   sif->DeleteValue("PCDrv", "EnableWrites");
   sif->DeleteValue("PCDrv", "Root");
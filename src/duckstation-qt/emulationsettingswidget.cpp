@@ -24,6 +24,8 @@ EmulationSettingsWidget::EmulationSettingsWidget(SettingsWindow* dialog, QWidget
                                                "SkipPresentingDuplicateFrames", false);
   SettingWidgetBinder::BindWidgetToFloatSetting(sif, m_ui.preFrameSleepBuffer, "Display", "PreFrameSleepBuffer",
                                                 Settings::DEFAULT_DISPLAY_PRE_FRAME_SLEEP_BUFFER);
+  SettingWidgetBinder::BindWidgetToFloatSetting(sif, m_ui.preFrameSleepMissRate, "Display", "PreFrameSleepMissRate",
+                                                Settings::DEFAULT_DISPLAY_PRE_FRAME_SLEEP_MISS_RATE);
   SettingWidgetBinder::BindWidgetToBoolSetting(sif, m_ui.rewindEnable, "Main", "RewindEnable", false);
   SettingWidgetBinder::BindWidgetToFloatSetting(sif, m_ui.rewindSaveFrequency, "Main", "RewindFrequency", 10.0f);
   SettingWidgetBinder::BindWidgetToIntSetting(sif, m_ui.rewindSaveSlots, "Main", "RewindSaveSlots", 10);
@@ -125,6 +127,11 @@ EmulationSettingsWidget::EmulationSettingsWidget(SettingsWindow* dialog, QWidget
                              tr("Specifies the amount of buffer time added, which reduces the additional sleep time "
                                 "introduced. Higher values increase input latency, but decrease the risk of overrun, "
                                 "or missed frames. Lower values require faster hardware."));
+  dialog->registerWidgetHelp(m_ui.preFrameSleepMissRate, tr("Target Miss Rate"),
+                             tr("%1%").arg(Settings::DEFAULT_DISPLAY_PRE_FRAME_SLEEP_MISS_RATE),
+                             tr("Specifies the percentage of frames which may be displayed late because the start of "
+                                "the frame was delayed too much. The delay adapts to the time taken by recent frames "
+                                "to stay under this rate. Lower values increase input latency."));
   dialog->registerWidgetHelp(
     m_ui.skipPresentingDuplicateFrames, tr("Skip Duplicate Frame Display"), tr("Unchecked"),
     tr("Skips the presentation/display of frames that are not unique. Can be combined with driver-level frame "
@@ -222,6 +229,8 @@ void EmulationSettingsWidget::onPreFrameSleepChanged()
   const bool show_buffer_size = (m_ui.preFrameSleep->isEnabled() && pre_frame_sleep_enabled);
   m_ui.preFrameSleepBuffer->setVisible(show_buffer_size);
   m_ui.preFrameSleepBufferLabel->setVisible(show_buffer_size);
+  m_ui.preFrameSleepMissRate->setVisible(show_buffer_size);
+  m_ui.preFrameSleepMissRateLabel->setVisible(show_buffer_size);
 }
 
 void EmulationSettingsWidget::updateSkipDuplicateFramesEnabled()
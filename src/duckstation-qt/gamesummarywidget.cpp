@@ -396,31 +396,17 @@ void GameSummaryWidget::onComputeHashClicked()
   }
 
   QtModalProgressCallback progress_callback(this);
-  progress_callback.SetProgressRange(image->GetTrackCount());
-
-  std::vector<CDImageHasher::Hash> track_hashes;
-  track_hashes.reserve(image->GetTrackCount());
 
   // Calculate hashes
-  bool calculate_hash_success = true;
-  for (u8 track = 1; track <= image->GetTrackCount(); track++)
+  std::vector<CDImageHasher::Hash> track_hashes;
+  const bool calculate_hash_success = CDImageHasher::GetTrackHashes(image.get(), &track_hashes, &progress_callback);
+  if (calculate_hash_success)
   {
-    progress_callback.SetProgressValue(track - 1);
-    progress_callback.PushState();
-
-    CDImageHasher::Hash hash;
-    if (!CDImageHasher::GetTrackHash(image.get(), track, &hash, &progress_callback))
+    for (u8 track = 1; track <= image->GetTrackCount(); track++)
     {
-      progress_callback.PopState();
-      calculate_hash_success = false;
-      break;
+      QTableWidgetItem* item = m_ui.tracks->item(track - 1, 4);
+      item->setText(QString::fromStdString(CDImageHasher::HashToString(track_hashes[track - 1])));
     }
-    track_hashes.emplace_back(hash);
-
-    QTableWidgetItem* item = m_ui.tracks->item(track - 1, 4);
-    item->setText(QString::fromStdString(CDImageHasher::HashToString(hash)));
-
-    progress_callback.PopState();
   }
 
   // Verify hashes against gamedb
@@ -432,6 +418,7 @@ void GameSummaryWidget::onComputeHashClicked()
     m_redump_search_keyword = CDImageHasher::HashToString(track_hashes.front());
 
     progress_callback.SetStatusText(TRANSLATE("GameSummaryWidget", "Verifying hashes..."));
+    progress_callback.SetProgressRange(image->GetTrackCount());
     progress_callback.SetProgressValue(image->GetTrackCount());
 
     // Verification strategy used:
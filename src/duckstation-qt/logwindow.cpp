@@ -154,6 +154,10 @@ void LogWindow::createUi()
   action->setCheckable(true);
   SettingWidgetBinder::BindWidgetToBoolSetting(nullptr, action, "Logging", "LogTimestamps", true);
 
+  action = settings_menu->addAction(tr("Write &Asynchronously"));
+  action->setCheckable(true);
+  SettingWidgetBinder::BindWidgetToBoolSetting(nullptr, action, "Logging", "LogAsync", false);
+
   settings_menu->addSeparator();
 
   m_level_menu = settings_menu->addMenu(tr("&Log Level"));
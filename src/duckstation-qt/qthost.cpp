@@ -1548,7 +1548,7 @@ void EmuThread::dumpVRAM(const QString& filename)
 
   const std::string filename_str = filename.toStdString();
   if (System::DumpVRAM(filename_str.c_str()))
-    Host::AddOSDMessage(fmt::format("VRAM dumped to '{}'", filename_str), 10.0f);
+    Host::AddOSDMessage(fmt::format("Writing VRAM dump to '{}'.", filename_str), 10.0f);
   else
     Host::ReportErrorAsync("Error", fmt::format("Failed to dump VRAM to '{}'", filename_str));
 }
@@ -2635,6 +2635,7 @@ shutdown_and_exit:
   }
 
   // Ensure log is flushed.
+  Log::SetAsyncOutputEnabled(false);
   Log::SetFileOutputParams(false, nullptr);
 
   System::Internal::ProcessShutdown();
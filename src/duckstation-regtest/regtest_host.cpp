@@ -3,6 +3,7 @@
 
 #include "core/achievements.h"
 #include "core/controller.h"
+#include "core/frame_pacer.h"
 #include "core/fullscreen_ui.h"
 #include "core/game_list.h"
 #include "core/gpu.h"
@@ -12,13 +13,16 @@
 #include "scmversion/scmversion.h"
 
 #include "util/cd_image.h"
+#include "util/cd_image_hasher.h"
 #include "util/gpu_device.h"
 #include "util/imgui_fullscreen.h"
 #include "util/imgui_manager.h"
 #include "util/input_manager.h"
 #include "util/platform_misc.h"
 
+#include "common/align.h"
 #include "common/assert.h"
+#include "common/bitutils.h"
 #include "common/crash_handler.h"
 #include "common/error.h"
 #include "common/file_system.h"
@@ -30,6 +34,7 @@
 
 #include <csignal>
 #include <cstdio>
+#include <vector>
 
 Log_SetChannel(RegTestHost);
 
@@ -43,8 +48,20 @@ static void HookSignals();
 static bool SetFolders();
 static bool SetNewDataRoot(const std::string& filename);
 static std::string GetFrameDumpFilename(u32 frame);
+static void RecordPacingSample();
+static void ReportPacingSimulation();
+static bool ExtractStateSection();
 } // namespace RegTestHost
 
+namespace {
+struct PacingSample
+{
+  Common::Timer::Value active_time;
+  Common::Timer::Value frame_period;
+  u32 phase;
+};
+} // namespace
+
 static std::unique_ptr<MemorySettingsInterface> s_base_settings_interface;
 
 static u32 s_frames_to_run = 60 * 60;
@@ -52,6 +69,14 @@ static u32 s_frames_remaining = 0;
 static u32 s_frame_dump_interval = 0;
 static std::string s_dump_base_directory;
 
+static bool s_simulate_pacing = false;
+static Common::Timer::Value s_last_frame_done_time = 0;
+static std::vector<PacingSample> s_pacing_samples;
+
+static std::string s_extract_state_path;
+static std::string s_extract_section_name;
+static std::string s_extract_output_path;
+
 bool RegTestHost::SetFolders()
 {
   std::string program_path(FileSystem::GetProgramPath());
@@ -366,6 +391,9 @@ void Host::FrameDone()
     std::string dump_filename(RegTestHost::GetFrameDumpFilename(frame));
     g_gpu->WriteDisplayTextureToFile(std::move(dump_filename));
   }
+
+  if (s_simulate_pacing)
+    RegTestHost::RecordPacingSample();
 }
 
 void Host::OpenURL(std::string_view url)
@@ -512,7 +540,10 @@ void RegTestHost::PrintCommandLineHelp(const char* progname)
   std::fprintf(stderr, "  -dumpdir: Set frame dump base directory (will be dumped to basedir/gametitle).\n");
   std::fprintf(stderr, "  -dumpinterval: Dumps every N frames.\n");
   std::fprintf(stderr, "  -frames: Sets the number of frames to execute.\n");
+  std::fprintf(stderr, "  -pacing: Replays frame times against a simulated vsync clock to compare pre-frame sleep.\n");
   std::fprintf(stderr, "  -log <level>: Sets the log level. Defaults to verbose.\n");
+  std::fprintf(stderr, "  -extractsection <state> <section> <output>: Writes one decompressed save state section,\n"
+                       "    e.g. Bus for RAM, to a file and exits.\n");
   std::fprintf(stderr, "  -renderer <renderer>: Sets the graphics renderer. Default to software.\n");
   std::fprintf(stderr, "  --: Signals that no more arguments will follow and the remaining\n"
                        "    parameters make up the filename. Use when the filename contains\n"
@@ -581,6 +612,18 @@ bool RegTestHost::ParseCommandLineParameters(int argc, char* argv[], std::option
 
         continue;
       }
+      else if (CHECK_ARG("-pacing"))
+      {
+        s_simulate_pacing = true;
+        continue;
+      }
+      else if (CHECK_ARG("-extractsection") && (i + 3) < argc)
+      {
+        s_extract_state_path = argv[++i];
+        s_extract_section_name = argv[++i];
+        s_extract_output_path = argv[++i];
+        continue;
+      }
       else if (CHECK_ARG_PARAM("-log"))
       {
         std::optional<LOGLEVEL> level = Settings::ParseLogLevelName(argv[++i]);
@@ -708,6 +751,17 @@ bool RegTestHost::SetNewDataRoot(const std::string& filename)
         Panic("Failed to create dump directory.");
     }
 
+    // Record which image the dumps came from, so runs against different dumps of the same game aren't compared.
+    // Only used to tell images apart, so the faster hash will do.
+    CDImageHasher::Hash image_hash;
+    if (CDImageHasher::GetImageHash(image.get(), &image_hash, ProgressCallback::NullProgressCallback,
+                                    CDImageHasher::HashAlgorithm::XXH3_128))
+    {
+      const std::string image_hash_str = CDImageHasher::HashToString(image_hash);
+      INFO_LOG("Image hash: {}", image_hash_str);
+      FileSystem::WriteStringToFile(Path::Combine(dump_directory, "image_hash.txt").c_str(), image_hash_str);
+    }
+
     // Switch to file logging.
     INFO_LOG("Dumping frames to '{}'...", dump_directory);
     EmuFolders::DataRoot = std::move(dump_directory);
@@ -725,6 +779,108 @@ std::string RegTestHost::GetFrameDumpFilename(u32 frame)
   return Path::Combine(EmuFolders::DataRoot, fmt::format("frame_{:05d}.png", frame));
 }
 
+void RegTestHost::RecordPacingSample()
+{
+  // We're running unthrottled, so the time between frames is the time spent emulating.
+  const Common::Timer::Value current_time = Common::Timer::GetCurrentValue();
+  const Common::Timer::Value active_time = current_time - std::exchange(s_last_frame_done_time, current_time);
+  if (active_time == current_time)
+    return;
+
+  s_pacing_samples.push_back(
+    PacingSample{active_time, Common::Timer::ConvertSecondsToValue(1.0 / System::GetThrottleFrequency()),
+                 g_gpu->GetDisplayModeKey()});
+}
+
+void RegTestHost::ReportPacingSimulation()
+{
+  // Each frame starts at a vsync plus the pre-frame sleep, and is displayed at the first vsync after it finishes.
+  // Latency is measured from the start of the frame, where input is polled, to that vsync.
+  const auto simulate = [](const char* name, const auto& get_sleep_time, const auto& add_frame) {
+    double total_latency = 0.0;
+    u32 late_frames = 0;
+    for (const PacingSample& sample : s_pacing_samples)
+    {
+      const Common::Timer::Value sleep_time = get_sleep_time(sample);
+      const Common::Timer::Value end_time = sleep_time + sample.active_time;
+      const Common::Timer::Value vsyncs = std::max<Common::Timer::Value>(
+        (end_time + sample.frame_period - 1) / sample.frame_period, 1);
+      const bool missed = (end_time > sample.frame_period);
+      total_latency += Common::Timer::ConvertValueToMilliseconds(vsyncs * sample.frame_period - sleep_time);
+      late_frames += BoolToUInt32(missed);
+      add_frame(sample, missed);
+    }
+
+    INFO_LOG("{:<10} average latency {:.2f} ms, {} late frames ({:.2f}%)", name,
+             total_latency / static_cast<double>(s_pacing_samples.size()), late_frames,
+             static_cast<double>(late_frames) * 100.0 / static_cast<double>(s_pacing_samples.size()));
+  };
+
+  if (s_pacing_samples.empty())
+    return;
+
+  const Common::Timer::Value buffer =
+    Common::Timer::ConvertMillisecondsToValue(g_settings.display_pre_frame_sleep_buffer);
+  const unsigned int sleep_alignment = static_cast<unsigned int>(Common::Timer::ConvertMillisecondsToValue(1));
+  INFO_LOG("Simulating frame pacing over {} frames, {:.1f} ms buffer, {:.1f}% target miss rate:",
+           s_pacing_samples.size(), g_settings.display_pre_frame_sleep_buffer,
+           g_settings.display_pre_frame_sleep_miss_rate);
+
+  simulate("No sleep", [](const PacingSample&) { return Common::Timer::Value(0); },
+           [](const PacingSample&, bool) {});
+
+  // Sleep based on the longest frame in the last second, backing off immediately on overrun.
+  Common::Timer::Value fixed_sleep_time = 0;
+  Common::Timer::Value max_active_time = 0;
+  u32 frames_in_window = 0;
+  simulate(
+    "Fixed", [&fixed_sleep_time](const PacingSample&) { return fixed_sleep_time; },
+    [&](const PacingSample& sample, bool) {
+      max_active_time = std::max(max_active_time, sample.active_time);
+      const Common::Timer::Value max_sleep_time =
+        sample.frame_period - std::min(sample.active_time, sample.frame_period);
+      if (max_sleep_time < fixed_sleep_time)
+        fixed_sleep_time = Common::AlignDown(max_sleep_time, sleep_alignment);
+
+      if ((++frames_in_window * sample.frame_period) >= Common::Timer::ConvertSecondsToValue(1.0))
+      {
+        fixed_sleep_time = Common::AlignDown(
+          sample.frame_period - std::min(max_active_time + buffer, sample.frame_period), sleep_alignment);
+        max_active_time = 0;
+        frames_in_window = 0;
+      }
+    });
+
+  FramePacer pacer;
+  pacer.SetTargetMissRate(g_settings.display_pre_frame_sleep_miss_rate / 100.0f);
+  Common::Timer::Value predicted_sleep_time = 0;
+  simulate(
+    "Predictive", [&predicted_sleep_time](const PacingSample&) { return predicted_sleep_time; },
+    [&](const PacingSample& sample, bool missed) {
+      pacer.SetPhase(sample.phase);
+      pacer.AddFrame(sample.active_time, sample.frame_period, missed);
+      predicted_sleep_time = pacer.GetSleepTime(sample.frame_period, buffer);
+    });
+}
+
+bool RegTestHost::ExtractStateSection()
+{
+  Error error;
+  std::vector<u8> data;
+  u32 version;
+  if (!System::ReadSaveStateSection(s_extract_state_path.c_str(), s_extract_section_name, &data, &version, &error) ||
+      !FileSystem::WriteBinaryFile(s_extract_output_path.c_str(), data.data(), data.size(), &error))
+  {
+    ERROR_LOG("Failed to extract section '{}' from '{}': {}", s_extract_section_name, s_extract_state_path,
+              error.GetDescription());
+    return false;
+  }
+
+  INFO_LOG("Wrote {} bytes of section '{}' (state version {}) to '{}'.", data.size(), s_extract_section_name, version,
+           s_extract_output_path);
+  return true;
+}
+
 int main(int argc, char* argv[])
 {
   RegTestHost::InitializeEarlyConsole();
@@ -736,6 +892,9 @@ int main(int argc, char* argv[])
   if (!RegTestHost::ParseCommandLineParameters(argc, argv, autoboot))
     return EXIT_FAILURE;
 
+  if (!s_extract_state_path.empty())
+    return RegTestHost::ExtractStateSection() ? EXIT_SUCCESS : EXIT_FAILURE;
+
   if (!autoboot || autoboot->filename.empty())
   {
     ERROR_LOG("No boot path specified.");
@@ -792,6 +951,9 @@ int main(int argc, char* argv[])
              static_cast<double>(s_frames_to_run) / elapsed_time_ms * 1000.0);
   }
 
+  if (s_simulate_pacing)
+    RegTestHost::ReportPacingSimulation();
+
   INFO_LOG("Exiting with success.");
   result = 0;
 
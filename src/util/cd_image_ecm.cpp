@@ -12,8 +12,9 @@
 
 #include "libchdr/cdrom.h"
 
+#include <algorithm>
 #include <array>
-#include <map>
+#include <vector>
 
 Log_SetChannel(CDImageEcm);
 
@@ -35,7 +36,27 @@ protected:
   bool ReadSectorFromIndex(void* buffer, const Index& index, LBA lba_in_index) override;
 
 private:
-  bool ReadChunks(u32 disc_offset, u32 size);
+  // Number of sectors decoded per file access, sequential reads are served from the window.
+  static constexpr u32 READAHEAD_SECTORS = 16;
+
+  // Number of decoded windows kept around for re-reads.
+  static constexpr u32 NUM_CACHED_WINDOWS = 8;
+
+  struct ChunkWindow
+  {
+    std::vector<u8> data;
+    u32 disc_start = 0;
+    u32 last_access = 0;
+
+    ALWAYS_INLINE bool Contains(u32 start, u32 end) const
+    {
+      return (start >= disc_start && end <= (disc_start + static_cast<u32>(data.size())));
+    }
+  };
+
+  ChunkWindow* FindWindow(u32 start, u32 end);
+  ChunkWindow* GetOldestWindow();
+  bool ReadChunks(ChunkWindow* window, u32 disc_offset, u32 size);
 
   std::FILE* m_fp = nullptr;
 
@@ -64,16 +85,26 @@ private:
 
   struct SectorEntry
   {
+    u32 disc_offset;
     u32 file_offset;
     u32 chunk_size;
     SectorType type;
+
+    ALWAYS_INLINE u32 GetSizeInFile() const
+    {
+      return (type == SectorType::Raw) ? chunk_size : s_sector_sizes[static_cast<u32>(type)];
+    }
   };
 
-  using DataMap = std::map<u32, SectorEntry>;
+  // Sorted by disc_offset, looked up with a binary search.
+  std::vector<SectorEntry> m_data_map;
+  u32 m_disc_size = 0;
 
-  DataMap m_data_map;
-  std::vector<u8> m_chunk_buffer;
-  u32 m_chunk_start = 0;
+  std::array<ChunkWindow, NUM_CACHED_WINDOWS> m_windows;
+  ChunkWindow* m_current_window = nullptr;
+  u32 m_window_counter = 0;
+
+  std::vector<u8> m_file_buffer;
 
   CDSubChannelReplacement m_sbi;
 };
@@ -169,7 +200,7 @@ bool CDImageEcm::Open(const char* filename, Error* error)
       while (count > 0)
       {
         const u32 size = std::min<u32>(count, 2352);
-        m_data_map.emplace(disc_offset, SectorEntry{file_offset, size, type});
+        m_data_map.push_back(SectorEntry{disc_offset, file_offset, size, type});
         disc_offset += size;
         file_offset += size;
         count -= size;
@@ -187,7 +218,7 @@ bool CDImageEcm::Open(const char* filename, Error* error)
       const u32 chunk_size = s_chunk_sizes[static_cast<u32>(type)];
       for (u32 i = 0; i < count; i++)
       {
-        m_data_map.emplace(disc_offset, SectorEntry{file_offset, chunk_size, type});
+        m_data_map.push_back(SectorEntry{disc_offset, file_offset, chunk_size, type});
         disc_offset += chunk_size;
         file_offset += size;
 
@@ -214,6 +245,7 @@ bool CDImageEcm::Open(const char* filename, Error* error)
     return false;
   }
 
+  m_disc_size = disc_offset;
   m_lba_count = disc_offset / RAW_SECTOR_SIZE;
   if ((disc_offset % RAW_SECTOR_SIZE) != 0)
     WARNING_LOG("ECM image is misaligned with offset {}", disc_offset);
@@ -262,44 +294,82 @@ bool CDImageEcm::Open(const char* filename, Error* error)
 
   m_sbi.LoadFromImagePath(filename);
 
-  m_chunk_buffer.reserve(RAW_SECTOR_SIZE * 2);
+  m_data_map.shrink_to_fit();
+  m_file_buffer.reserve(READAHEAD_SECTORS * (RAW_SECTOR_SIZE + 16));
+  for (ChunkWindow& window : m_windows)
+    window.data.reserve((READAHEAD_SECTORS + 1) * RAW_SECTOR_SIZE);
+
   return Seek(1, Position{0, 0, 0});
 }
 
-bool CDImageEcm::ReadChunks(u32 disc_offset, u32 size)
+CDImageEcm::ChunkWindow* CDImageEcm::FindWindow(u32 start, u32 end)
 {
-  DataMap::iterator next =
-    m_data_map.lower_bound((disc_offset > RAW_SECTOR_SIZE) ? (disc_offset - RAW_SECTOR_SIZE) : 0);
-  DataMap::iterator current = m_data_map.begin();
-  while (next != m_data_map.end() && next->first <= disc_offset)
-    current = next++;
-
-  // extra bytes if we need to buffer some at the start
-  m_chunk_start = current->first;
-  m_chunk_buffer.clear();
-  if (m_chunk_start < disc_offset)
-    size += (disc_offset - current->first);
-
-  u32 total_bytes_read = 0;
-  while (total_bytes_read < size)
+  for (ChunkWindow& window : m_windows)
   {
-    if (current == m_data_map.end() || std::fseek(m_fp, current->second.file_offset, SEEK_SET) != 0)
-      return false;
+    if (window.Contains(start, end))
+      return &window;
+  }
 
-    const u32 chunk_size = current->second.chunk_size;
-    const u32 chunk_start = static_cast<u32>(m_chunk_buffer.size());
-    m_chunk_buffer.resize(chunk_start + chunk_size);
+  return nullptr;
+}
 
-    if (current->second.type == SectorType::Raw)
-    {
-      if (std::fread(&m_chunk_buffer[chunk_start], chunk_size, 1, m_fp) != 1)
-        return false;
+CDImageEcm::ChunkWindow* CDImageEcm::GetOldestWindow()
+{
+  ChunkWindow* oldest = &m_windows[0];
+  for (ChunkWindow& window : m_windows)
+  {
+    if (window.data.empty())
+      return &window;
+    else if (window.last_access < oldest->last_access)
+      oldest = &window;
+  }
 
-      total_bytes_read += chunk_size;
+  return oldest;
+}
+
+bool CDImageEcm::ReadChunks(ChunkWindow* window, u32 disc_offset, u32 size)
+{
+  window->data.clear();
+
+  // find the chunk containing the start offset, the first chunk always begins at zero
+  auto first = std::upper_bound(m_data_map.begin(), m_data_map.end(), disc_offset,
+                                [](u32 offset, const SectorEntry& entry) { return offset < entry.disc_offset; });
+  if (first == m_data_map.begin())
+    return false;
+  --first;
+
+  // and the chunk after the last one that we need
+  const u32 disc_end = disc_offset + size;
+  auto last = first;
+  while (last != m_data_map.end() && last->disc_offset < disc_end)
+    ++last;
+
+  // chunks are stored sequentially, so the whole range can be pulled in with a single read
+  const u32 file_start = first->file_offset;
+  const u32 file_end = std::prev(last)->file_offset + std::prev(last)->GetSizeInFile();
+  m_file_buffer.resize(file_end - file_start);
+  if (std::fseek(m_fp, file_start, SEEK_SET) != 0 ||
+      std::fread(m_file_buffer.data(), m_file_buffer.size(), 1, m_fp) != 1)
+  {
+    ERROR_LOG("Failed to read {} bytes at offset {}", m_file_buffer.size(), file_start);
+    return false;
+  }
+
+  window->disc_start = first->disc_offset;
+  window->data.resize(std::prev(last)->disc_offset + std::prev(last)->chunk_size - first->disc_offset);
+
+  for (auto current = first; current != last; ++current)
+  {
+    const u8* src = &m_file_buffer[current->file_offset - file_start];
+    u8* dst = &window->data[current->disc_offset - window->disc_start];
+    const u32 chunk_size = current->chunk_size;
+
+    if (current->type == SectorType::Raw)
+    {
+      std::memcpy(dst, src, chunk_size);
     }
     else
     {
-      // u8* sector = &m_chunk_buffer[chunk_start];
       u8 sector[RAW_SECTOR_SIZE];
 
       // TODO: needed?
@@ -307,13 +377,13 @@ bool CDImageEcm::ReadChunks(u32 disc_offset, u32 size)
       std::memset(sector + 1, 0xFF, 10);
 
       u32 skip;
-      switch (current->second.type)
+      switch (current->type)
       {
         case SectorType::Mode1:
         {
           sector[0x0F] = 0x01;
-          if (std::fread(sector + 0x00C, 0x003, 1, m_fp) != 1 || std::fread(sector + 0x010, 0x800, 1, m_fp) != 1)
-            return false;
+          std::memcpy(sector + 0x00C, src, 0x003);
+          std::memcpy(sector + 0x010, src + 0x003, 0x800);
 
           edc_set(&sector[2064], edc_compute(sector, 2064));
           ecc_generate(sector);
@@ -324,8 +394,7 @@ bool CDImageEcm::ReadChunks(u32 disc_offset, u32 size)
         case SectorType::Mode2Form1:
         {
           sector[0x0F] = 0x02;
-          if (std::fread(sector + 0x014, 0x804, 1, m_fp) != 1)
-            return false;
+          std::memcpy(sector + 0x014, src, 0x804);
 
           sector[0x10] = sector[0x14];
           sector[0x11] = sector[0x15];
@@ -341,8 +410,7 @@ bool CDImageEcm::ReadChunks(u32 disc_offset, u32 size)
         case SectorType::Mode2Form2:
         {
           sector[0x0F] = 0x02;
-          if (std::fread(sector + 0x014, 0x918, 1, m_fp) != 1)
-            return false;
+          std::memcpy(sector + 0x014, src, 0x918);
 
           sector[0x10] = sector[0x14];
           sector[0x11] = sector[0x15];
@@ -359,11 +427,8 @@ bool CDImageEcm::ReadChunks(u32 disc_offset, u32 size)
           return false;
       }
 
-      std::memcpy(&m_chunk_buffer[chunk_start], sector + skip, chunk_size);
-      total_bytes_read += chunk_size;
+      std::memcpy(dst, sector + skip, chunk_size);
     }
-
-    ++current;
   }
 
   return true;
@@ -387,16 +452,33 @@ bool CDImageEcm::ReadSectorFromIndex(void* buffer, const Index& index, LBA lba_i
   const u32 file_start = static_cast<u32>(index.file_offset) + (lba_in_index * index.file_sector_size);
   const u32 file_end = file_start + RAW_SECTOR_SIZE;
 
-  if (file_start < m_chunk_start || file_end > (m_chunk_start + m_chunk_buffer.size()))
+  ChunkWindow* window = m_current_window;
+  if (!window || !window->Contains(file_start, file_end))
   {
-    if (!ReadChunks(file_start, RAW_SECTOR_SIZE))
-      return false;
+    window = FindWindow(file_start, file_end);
+    if (!window)
+    {
+      // decode a few sectors ahead, since reads are usually sequential
+      window = GetOldestWindow();
+      const u32 remaining = (file_start < m_disc_size) ? (m_disc_size - file_start) : 0;
+      const u32 read_size =
+        std::max<u32>(std::min<u32>(READAHEAD_SECTORS * RAW_SECTOR_SIZE, remaining), RAW_SECTOR_SIZE);
+      if (!ReadChunks(window, file_start, read_size) || !window->Contains(file_start, file_end))
+      {
+        window->data.clear();
+        m_current_window = nullptr;
+        return false;
+      }
+    }
+
+    m_current_window = window;
   }
 
-  DebugAssert(file_start >= m_chunk_start && file_end <= (m_chunk_start + m_chunk_buffer.size()));
+  DebugAssert(window->Contains(file_start, file_end));
+  window->last_access = ++m_window_counter;
 
-  const size_t chunk_offset = static_cast<size_t>(file_start - m_chunk_start);
-  std::memcpy(buffer, &m_chunk_buffer[chunk_offset], RAW_SECTOR_SIZE);
+  const size_t chunk_offset = static_cast<size_t>(file_start - window->disc_start);
+  std::memcpy(buffer, &window->data[chunk_offset], RAW_SECTOR_SIZE);
   return true;
 }
 
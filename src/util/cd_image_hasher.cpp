@@ -6,84 +6,320 @@
 
 #include "util/host.h"
 
+#include "common/assert.h"
 #include "common/md5_digest.h"
 #include "common/string_util.h"
 
+#include "xxhash.h"
+
+#include <condition_variable>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+
 namespace CDImageHasher {
 
-static bool ReadIndex(CDImage* image, u8 track, u8 index, MD5Digest* digest, ProgressCallback* progress_callback);
-static bool ReadTrack(CDImage* image, u8 track, MD5Digest* digest, ProgressCallback* progress_callback);
+namespace {
+
+class TrackDigest
+{
+public:
+  explicit TrackDigest(HashAlgorithm algorithm);
+  TrackDigest(TrackDigest&& move);
+  TrackDigest(const TrackDigest&) = delete;
+  ~TrackDigest();
+
+  void Update(const u8* data, u32 size);
+  void Final(Hash* hash);
+
+private:
+  HashAlgorithm m_algorithm;
+  MD5Digest m_md5;
+  XXH3_state_t* m_xxh3 = nullptr;
+};
+
+struct SectorRange
+{
+  u32 track_slot;
+  u8 track;
+  CDImage::LBA start;
+  u32 length;
+};
+
+/// Reads sectors on a worker thread, so that decompression overlaps with hashing on the calling thread.
+class HashPipeline
+{
+public:
+  HashPipeline(CDImage* image, std::vector<SectorRange> ranges);
+  ~HashPipeline();
+
+  bool Run(std::span<TrackDigest> digests, ProgressCallback* progress_callback);
+
+private:
+  static constexpr u32 SECTORS_PER_BATCH = 64;
+  static constexpr u32 NUM_BATCHES = 8;
+
+  struct Batch
+  {
+    u32 range_index;
+    u32 num_sectors;
+    std::array<u8, SECTORS_PER_BATCH * CDImage::RAW_SECTOR_SIZE> data;
+  };
+
+  void ReaderThreadEntryPoint();
+
+  CDImage* m_image;
+  std::vector<SectorRange> m_ranges;
+
+  std::unique_ptr<Batch[]> m_batches;
+  u32 m_batch_head = 0;  // next batch to hash
+  u32 m_batch_count = 0; // batches filled and waiting to be hashed
+
+  std::mutex m_mutex;
+  std::condition_variable m_batch_ready_cv;
+  std::condition_variable m_batch_free_cv;
+  std::thread m_reader_thread;
+
+  std::string m_error;
+  bool m_reader_done = false;
+  bool m_cancelled = false;
+};
+
+} // namespace
+
+static std::vector<SectorRange> GetTrackSectorRanges(CDImage* image, u8 track, u32 track_slot);
+static bool HashTracks(CDImage* image, std::span<const u8> tracks, std::span<Hash> out_hashes,
+                       ProgressCallback* progress_callback, HashAlgorithm algorithm);
 
 } // namespace CDImageHasher
 
-bool CDImageHasher::ReadIndex(CDImage* image, u8 track, u8 index, MD5Digest* digest,
-                              ProgressCallback* progress_callback)
+CDImageHasher::TrackDigest::TrackDigest(HashAlgorithm algorithm) : m_algorithm(algorithm)
+{
+  if (m_algorithm == HashAlgorithm::XXH3_128)
+  {
+    m_xxh3 = XXH3_createState();
+    XXH3_128bits_reset(m_xxh3);
+  }
+}
+
+CDImageHasher::TrackDigest::TrackDigest(TrackDigest&& move)
+  : m_algorithm(move.m_algorithm), m_md5(move.m_md5), m_xxh3(std::exchange(move.m_xxh3, nullptr))
+{
+}
+
+CDImageHasher::TrackDigest::~TrackDigest()
 {
-  const CDImage::LBA index_start = image->GetTrackIndexPosition(track, index);
-  const u32 index_length = image->GetTrackIndexLength(track, index);
-  const u32 update_interval = std::max<u32>(index_length / 100u, 1u);
+  if (m_xxh3)
+    XXH3_freeState(m_xxh3);
+}
 
-  progress_callback->SetStatusText(
-    fmt::format(TRANSLATE_FS("CDImageHasher", "Computing hash for Track {}/Index {}..."), track, index).c_str());
-  progress_callback->SetProgressRange(index_length);
+void CDImageHasher::TrackDigest::Update(const u8* data, u32 size)
+{
+  if (m_algorithm == HashAlgorithm::XXH3_128)
+    XXH3_128bits_update(m_xxh3, data, size);
+  else
+    m_md5.Update(data, size);
+}
 
-  if (!image->Seek(index_start))
+void CDImageHasher::TrackDigest::Final(Hash* hash)
+{
+  if (m_algorithm == HashAlgorithm::XXH3_128)
   {
-    progress_callback->FormatModalError("Failed to seek to sector {} for track {} index {}", index_start, track, index);
-    return false;
+    XXH128_canonical_t canonical;
+    XXH128_canonicalFromHash(&canonical, XXH3_128bits_digest(m_xxh3));
+    static_assert(sizeof(canonical.digest) == std::tuple_size_v<Hash>);
+    std::memcpy(hash->data(), canonical.digest, sizeof(canonical.digest));
   }
+  else
+  {
+    m_md5.Final(*hash);
+  }
+}
 
-  std::array<u8, CDImage::RAW_SECTOR_SIZE> sector;
-  for (u32 lba = 0; lba < index_length; lba++)
+CDImageHasher::HashPipeline::HashPipeline(CDImage* image, std::vector<SectorRange> ranges)
+  : m_image(image), m_ranges(std::move(ranges)), m_batches(std::make_unique<Batch[]>(NUM_BATCHES))
+{
+}
+
+CDImageHasher::HashPipeline::~HashPipeline()
+{
+  if (m_reader_thread.joinable())
   {
-    if ((lba % update_interval) == 0)
-      progress_callback->SetProgressValue(lba);
+    {
+      std::unique_lock lock(m_mutex);
+      m_cancelled = true;
+      m_batch_free_cv.notify_one();
+    }
+
+    m_reader_thread.join();
+  }
+}
+
+void CDImageHasher::HashPipeline::ReaderThreadEntryPoint()
+{
+  std::unique_lock lock(m_mutex);
 
-    if (!image->ReadRawSector(sector.data(), nullptr))
+  for (u32 range_index = 0; range_index < static_cast<u32>(m_ranges.size()) && !m_cancelled; range_index++)
+  {
+    const SectorRange& range = m_ranges[range_index];
+    lock.unlock();
+    const bool seek_result = m_image->Seek(range.start);
+    lock.lock();
+    if (!seek_result)
     {
-      progress_callback->FormatModalError("Failed to read sector {} from image", image->GetPositionOnDisc());
-      return false;
+      m_error = fmt::format("Failed to seek to sector {} for track {}", range.start, range.track);
+      break;
     }
 
-    digest->Update(sector);
+    for (u32 sector = 0; sector < range.length;)
+    {
+      m_batch_free_cv.wait(lock, [this]() { return (m_cancelled || m_batch_count < NUM_BATCHES); });
+      if (m_cancelled)
+        break;
+
+      // Only this thread writes to free batches, so the lock can be dropped while reading.
+      Batch& batch = m_batches[(m_batch_head + m_batch_count) % NUM_BATCHES];
+      batch.range_index = range_index;
+      batch.num_sectors = std::min(range.length - sector, SECTORS_PER_BATCH);
+      lock.unlock();
+
+      bool read_result = true;
+      for (u32 i = 0; i < batch.num_sectors; i++)
+      {
+        if (!m_image->ReadRawSector(&batch.data[i * CDImage::RAW_SECTOR_SIZE], nullptr))
+        {
+          read_result = false;
+          break;
+        }
+      }
+
+      lock.lock();
+      if (!read_result)
+      {
+        m_error = fmt::format("Failed to read sector {} from image", m_image->GetPositionOnDisc());
+        m_cancelled = true;
+        break;
+      }
+
+      sector += batch.num_sectors;
+      m_batch_count++;
+      m_batch_ready_cv.notify_one();
+    }
   }
 
-  progress_callback->SetProgressValue(index_length);
-  return true;
+  m_reader_done = true;
+  m_batch_ready_cv.notify_one();
 }
 
-bool CDImageHasher::ReadTrack(CDImage* image, u8 track, MD5Digest* digest, ProgressCallback* progress_callback)
+bool CDImageHasher::HashPipeline::Run(std::span<TrackDigest> digests, ProgressCallback* progress_callback)
 {
-  static constexpr u8 INDICES_TO_READ = 2;
+  u32 total_sectors = 0;
+  for (const SectorRange& range : m_ranges)
+    total_sectors += range.length;
 
-  progress_callback->PushState();
+  progress_callback->SetProgressRange(std::max<u32>(total_sectors, 1u));
+  progress_callback->SetProgressValue(0);
 
-  const bool dataTrack = track == 1;
-  progress_callback->SetProgressRange(dataTrack ? 1 : 2);
+  m_reader_thread = std::thread(&HashPipeline::ReaderThreadEntryPoint, this);
 
-  u8 progress = 0;
-  for (u8 index = 0; index < INDICES_TO_READ; index++)
+  u32 sectors_hashed = 0;
+  u32 last_range_index = static_cast<u32>(-1);
+  std::unique_lock lock(m_mutex);
+  for (;;)
   {
-    progress_callback->SetProgressValue(progress);
+    m_batch_ready_cv.wait(lock, [this]() { return (m_batch_count > 0 || m_reader_done); });
+    if (m_batch_count == 0)
+      break;
 
-    // skip index 0 if data track
-    if (dataTrack && index == 0)
-      continue;
+    // Batches are only recycled once we advance the head, so it's safe to hash without the lock.
+    const Batch& batch = m_batches[m_batch_head];
+    lock.unlock();
 
-    progress++;
-    progress_callback->PushState();
-    if (!ReadIndex(image, track, index, digest, progress_callback))
+    const SectorRange& range = m_ranges[batch.range_index];
+    if (batch.range_index != last_range_index)
     {
-      progress_callback->PopState();
-      progress_callback->PopState();
-      return false;
+      progress_callback->FormatStatusText(TRANSLATE_FS("CDImageHasher", "Computing hash for Track {}..."),
+                                          range.track);
+      last_range_index = batch.range_index;
     }
 
-    progress_callback->PopState();
+    digests[range.track_slot].Update(batch.data.data(), batch.num_sectors * CDImage::RAW_SECTOR_SIZE);
+    sectors_hashed += batch.num_sectors;
+    progress_callback->SetProgressValue(sectors_hashed);
+
+    const bool cancelled = progress_callback->IsCancelled();
+
+    lock.lock();
+    m_batch_head = (m_batch_head + 1) % NUM_BATCHES;
+    m_batch_count--;
+    m_batch_free_cv.notify_one();
+
+    if (cancelled)
+    {
+      m_cancelled = true;
+      m_batch_free_cv.notify_one();
+      break;
+    }
+  }
+
+  lock.unlock();
+  m_reader_thread.join();
+
+  if (!m_error.empty())
+  {
+    progress_callback->ModalError(m_error);
+    return false;
+  }
+
+  return (!m_cancelled && sectors_hashed == total_sectors);
+}
+
+std::vector<CDImageHasher::SectorRange> CDImageHasher::GetTrackSectorRanges(CDImage* image, u8 track,
+                                                                           u32 track_slot)
+{
+  static constexpr u8 INDICES_TO_READ = 2;
+
+  std::vector<SectorRange> ranges;
+  for (u8 index = 0; index < INDICES_TO_READ; index++)
+  {
+    // skip index 0 if data track
+    if (track == 1 && index == 0)
+      continue;
+
+    const u32 index_length = image->GetTrackIndexLength(track, index);
+    if (index_length == 0)
+      continue;
+
+    ranges.push_back(SectorRange{track_slot, track, image->GetTrackIndexPosition(track, index), index_length});
+  }
+
+  return ranges;
+}
+
+bool CDImageHasher::HashTracks(CDImage* image, std::span<const u8> tracks, std::span<Hash> out_hashes,
+                               ProgressCallback* progress_callback, HashAlgorithm algorithm)
+{
+  DebugAssert(tracks.size() == out_hashes.size());
+
+  std::vector<SectorRange> ranges;
+  std::vector<TrackDigest> digests;
+  digests.reserve(tracks.size());
+  for (u32 i = 0; i < static_cast<u32>(tracks.size()); i++)
+  {
+    std::vector<SectorRange> track_ranges = GetTrackSectorRanges(image, tracks[i], i);
+    ranges.insert(ranges.end(), track_ranges.begin(), track_ranges.end());
+    digests.emplace_back(algorithm);
   }
 
-  progress_callback->SetProgressValue(progress);
-  progress_callback->PopState();
+  HashPipeline pipeline(image, std::move(ranges));
+  if (!pipeline.Run(digests, progress_callback))
+    return false;
+
+  for (u32 i = 0; i < static_cast<u32>(tracks.size()); i++)
+    digests[i].Final(&out_hashes[i]);
+
   return true;
 }
 
@@ -107,36 +343,43 @@ std::optional<CDImageHasher::Hash> CDImageHasher::HashFromString(std::string_vie
 }
 
 bool CDImageHasher::GetImageHash(CDImage* image, Hash* out_hash,
-                                 ProgressCallback* progress_callback /*= ProgressCallback::NullProgressCallback*/)
+                                 ProgressCallback* progress_callback /*= ProgressCallback::NullProgressCallback*/,
+                                 HashAlgorithm algorithm /*= HashAlgorithm::MD5*/)
 {
-  MD5Digest digest;
-
-  progress_callback->SetProgressRange(image->GetTrackCount());
-  progress_callback->SetProgressValue(0);
-  progress_callback->PushState();
-
+  // All tracks go into the same digest.
+  std::vector<SectorRange> ranges;
   for (u32 i = 1; i <= image->GetTrackCount(); i++)
   {
-    progress_callback->SetProgressValue(i - 1);
-    if (!ReadTrack(image, static_cast<u8>(i), &digest, progress_callback))
-    {
-      progress_callback->PopState();
-      return false;
-    }
+    std::vector<SectorRange> track_ranges = GetTrackSectorRanges(image, static_cast<u8>(i), 0);
+    ranges.insert(ranges.end(), track_ranges.begin(), track_ranges.end());
   }
 
-  progress_callback->SetProgressValue(image->GetTrackCount());
-  digest.Final(*out_hash);
+  TrackDigest digest(algorithm);
+  HashPipeline pipeline(image, std::move(ranges));
+  if (!pipeline.Run(std::span<TrackDigest>(&digest, 1), progress_callback))
+    return false;
+
+  digest.Final(out_hash);
   return true;
 }
 
 bool CDImageHasher::GetTrackHash(CDImage* image, u8 track, Hash* out_hash,
-                                 ProgressCallback* progress_callback /*= ProgressCallback::NullProgressCallback*/)
+                                 ProgressCallback* progress_callback /*= ProgressCallback::NullProgressCallback*/,
+                                 HashAlgorithm algorithm /*= HashAlgorithm::MD5*/)
 {
-  MD5Digest digest;
-  if (!ReadTrack(image, track, &digest, progress_callback))
-    return false;
+  return HashTracks(image, std::span<const u8>(&track, 1), std::span<Hash>(out_hash, 1), progress_callback,
+                    algorithm);
+}
 
-  digest.Final(*out_hash);
-  return true;
+bool CDImageHasher::GetTrackHashes(CDImage* image, std::vector<Hash>* out_hashes,
+                                   ProgressCallback* progress_callback /*= ProgressCallback::NullProgressCallback*/,
+                                   HashAlgorithm algorithm /*= HashAlgorithm::MD5*/)
+{
+  std::vector<u8> tracks;
+  tracks.reserve(image->GetTrackCount());
+  for (u32 i = 1; i <= image->GetTrackCount(); i++)
+    tracks.push_back(static_cast<u8>(i));
+
+  out_hashes->resize(tracks.size());
+  return HashTracks(image, tracks, *out_hashes, progress_callback, algorithm);
 }
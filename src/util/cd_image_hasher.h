@@ -7,6 +7,7 @@
 #include <array>
 #include <optional>
 #include <string>
+#include <vector>
 
 class CDImage;
 
@@ -16,9 +17,22 @@ using Hash = std::array<u8, 16>;
 std::string HashToString(const Hash& hash);
 std::optional<Hash> HashFromString(std::string_view str);
 
+enum class HashAlgorithm : u8
+{
+  MD5,      // Used for redump matching.
+  XXH3_128, // Much faster, only suitable for internal identification.
+};
+
 bool GetImageHash(CDImage* image, Hash* out_hash,
-                  ProgressCallback* progress_callback = ProgressCallback::NullProgressCallback);
+                  ProgressCallback* progress_callback = ProgressCallback::NullProgressCallback,
+                  HashAlgorithm algorithm = HashAlgorithm::MD5);
 bool GetTrackHash(CDImage* image, u8 track, Hash* out_hash,
-                  ProgressCallback* progress_callback = ProgressCallback::NullProgressCallback);
+                  ProgressCallback* progress_callback = ProgressCallback::NullProgressCallback,
+                  HashAlgorithm algorithm = HashAlgorithm::MD5);
+
+/// Hashes every track of the image in a single pass, returning one hash per track.
+bool GetTrackHashes(CDImage* image, std::vector<Hash>* out_hashes,
+                    ProgressCallback* progress_callback = ProgressCallback::NullProgressCallback,
+                    HashAlgorithm algorithm = HashAlgorithm::MD5);
 
-} // namespace CDImageHasher
\ No newline at end of file
+} // namespace CDImageHasher
@@ -14,10 +14,14 @@
 #include "zlib.h"
 
 #include <array>
+#include <condition_variable>
 #include <cstdio>
 #include <cstring>
+#include <deque>
 #include <map>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <variant>
 #include <vector>
 
@@ -148,12 +152,41 @@ protected:
   bool ReadSectorFromIndex(void* buffer, const Index& index, LBA lba_in_index) override;
 
 private:
+  // Number of decompressed blocks kept in memory.
+  static constexpr u32 NUM_CACHED_BLOCKS = 8;
+
+  // Number of blocks decompressed ahead of the read position when reading sequentially.
+  static constexpr u32 PREFETCH_BLOCK_COUNT = 2;
+
+  static constexpr u32 INVALID_BLOCK = static_cast<u32>(-1);
+
   struct BlockInfo
   {
     u32 offset; // Absolute offset from start of file
     u16 size;
   };
 
+  struct BlockDecompressor
+  {
+    ~BlockDecompressor();
+
+    bool Init();
+    bool Decompress(std::FILE* fp, const BlockInfo& block_info, u8* dst);
+
+    std::vector<u8> compressed_block;
+    z_stream inflate_stream = {};
+    bool initialized = false;
+  };
+
+  struct CachedBlock
+  {
+    u32 block_index = INVALID_BLOCK;
+    u32 last_access = 0;
+    bool pending = false;
+    bool valid = false;
+    std::array<u8, DECOMPRESSED_BLOCK_SIZE> data;
+  };
+
 #if _DEBUG
   static void PrintPBPHeaderInfo(const PBPHeader& pbp_header);
   static void PrintSFOHeaderInfo(const SFOHeader& sfo_header);
@@ -168,8 +201,14 @@ private:
 
   bool IsValidEboot(Error* error);
 
-  bool InitDecompressionStream();
-  bool DecompressBlock(const BlockInfo& block_info);
+  CachedBlock* LookupBlock(u32 block_index);
+  CachedBlock* AllocateBlock(u32 block_index);
+  const CachedBlock* GetBlock(u32 block_index);
+  void QueuePrefetch(u32 block_index);
+  void StartPrefetchThread();
+  void StopPrefetchThread();
+  void PrefetchThreadEntryPoint();
+  void FlushBlockCache();
 
   bool OpenDisc(u32 index, Error* error);
 
@@ -191,11 +230,20 @@ private:
 
   std::array<TOCEntry, TOC_NUM_ENTRIES> m_toc;
 
-  u32 m_current_block = static_cast<u32>(-1);
-  std::array<u8, DECOMPRESSED_BLOCK_SIZE> m_decompressed_block;
-  std::vector<u8> m_compressed_block;
-
-  z_stream m_inflate_stream;
+  std::array<CachedBlock, NUM_CACHED_BLOCKS> m_blocks;
+  const CachedBlock* m_current_block = nullptr;
+  u32 m_last_requested_block = INVALID_BLOCK;
+  u32 m_block_access_counter = 0;
+  BlockDecompressor m_decompressor;
+
+  // Blocks are decompressed ahead on a worker thread with its own file handle, so it can seek independently.
+  std::FILE* m_prefetch_file = nullptr;
+  std::thread m_prefetch_thread;
+  std::mutex m_block_mutex;
+  std::condition_variable m_prefetch_cv;
+  std::condition_variable m_prefetch_done_cv;
+  std::deque<std::pair<CachedBlock*, BlockInfo>> m_prefetch_queue;
+  bool m_prefetch_shutdown = false;
 
   CDSubChannelReplacement m_sbi;
 };
@@ -203,10 +251,13 @@ private:
 
 CDImagePBP::~CDImagePBP()
 {
+  StopPrefetchThread();
+
+  if (m_prefetch_file)
+    std::fclose(m_prefetch_file);
+
   if (m_file)
     fclose(m_file);
-
-  inflateEnd(&m_inflate_stream);
 }
 
 bool CDImagePBP::LoadPBPHeader()
@@ -513,11 +564,9 @@ bool CDImagePBP::OpenDisc(u32 index, Error* error)
     return false;
   }
 
-  m_current_block = static_cast<u32>(-1);
+  FlushBlockCache();
   m_blockinfo_table.fill({});
   m_toc.fill({});
-  m_decompressed_block.fill(0x00);
-  m_compressed_block.clear();
 
   // Go to ISO header
   const u32 iso_header_start = m_disc_offsets[index];
@@ -731,7 +780,7 @@ bool CDImagePBP::OpenDisc(u32 index, Error* error)
   AddLeadOutIndex();
 
   // Initialize zlib stream
-  if (!InitDecompressionStream())
+  if (!m_decompressor.Init())
   {
     ERROR_LOG("Failed to initialize zlib decompression stream");
     return false;
@@ -768,45 +817,51 @@ const std::string* CDImagePBP::LookupStringSFOTableEntry(const char* key, const
   return &std::get<std::string>(data_value);
 }
 
-bool CDImagePBP::InitDecompressionStream()
+CDImagePBP::BlockDecompressor::~BlockDecompressor()
+{
+  if (initialized)
+    inflateEnd(&inflate_stream);
+}
+
+bool CDImagePBP::BlockDecompressor::Init()
 {
-  m_inflate_stream = {};
-  m_inflate_stream.next_in = Z_NULL;
-  m_inflate_stream.avail_in = 0;
-  m_inflate_stream.zalloc = Z_NULL;
-  m_inflate_stream.zfree = Z_NULL;
-  m_inflate_stream.opaque = Z_NULL;
+  if (initialized)
+    return true;
 
-  int ret = inflateInit2(&m_inflate_stream, -MAX_WBITS);
-  return ret == Z_OK;
+  inflate_stream = {};
+  inflate_stream.next_in = Z_NULL;
+  inflate_stream.avail_in = 0;
+  inflate_stream.zalloc = Z_NULL;
+  inflate_stream.zfree = Z_NULL;
+  inflate_stream.opaque = Z_NULL;
+
+  initialized = (inflateInit2(&inflate_stream, -MAX_WBITS) == Z_OK);
+  return initialized;
 }
 
-bool CDImagePBP::DecompressBlock(const BlockInfo& block_info)
+bool CDImagePBP::BlockDecompressor::Decompress(std::FILE* fp, const BlockInfo& block_info, u8* dst)
 {
-  if (FileSystem::FSeek64(m_file, block_info.offset, SEEK_SET) != 0)
+  if (FileSystem::FSeek64(fp, block_info.offset, SEEK_SET) != 0)
     return false;
 
   // Compression level 0 has compressed size == decompressed size.
-  if (block_info.size == m_decompressed_block.size())
-  {
-    return (std::fread(m_decompressed_block.data(), sizeof(u8), m_decompressed_block.size(), m_file) ==
-            m_decompressed_block.size());
-  }
+  if (block_info.size == DECOMPRESSED_BLOCK_SIZE)
+    return (std::fread(dst, sizeof(u8), DECOMPRESSED_BLOCK_SIZE, fp) == DECOMPRESSED_BLOCK_SIZE);
 
-  m_compressed_block.resize(block_info.size);
+  compressed_block.resize(block_info.size);
 
-  if (std::fread(m_compressed_block.data(), sizeof(u8), m_compressed_block.size(), m_file) != m_compressed_block.size())
+  if (std::fread(compressed_block.data(), sizeof(u8), compressed_block.size(), fp) != compressed_block.size())
     return false;
 
-  m_inflate_stream.next_in = m_compressed_block.data();
-  m_inflate_stream.avail_in = static_cast<uInt>(m_compressed_block.size());
-  m_inflate_stream.next_out = m_decompressed_block.data();
-  m_inflate_stream.avail_out = static_cast<uInt>(m_decompressed_block.size());
+  inflate_stream.next_in = compressed_block.data();
+  inflate_stream.avail_in = static_cast<uInt>(compressed_block.size());
+  inflate_stream.next_out = dst;
+  inflate_stream.avail_out = static_cast<uInt>(DECOMPRESSED_BLOCK_SIZE);
 
-  if (inflateReset(&m_inflate_stream) != Z_OK)
+  if (inflateReset(&inflate_stream) != Z_OK)
     return false;
 
-  int err = inflate(&m_inflate_stream, Z_FINISH);
+  int err = inflate(&inflate_stream, Z_FINISH);
   if (err != Z_STREAM_END) [[unlikely]]
   {
     ERROR_LOG("Inflate error {}", err);
@@ -816,6 +871,169 @@ bool CDImagePBP::DecompressBlock(const BlockInfo& block_info)
   return true;
 }
 
+CDImagePBP::CachedBlock* CDImagePBP::LookupBlock(u32 block_index)
+{
+  for (CachedBlock& cb : m_blocks)
+  {
+    if (cb.block_index == block_index)
+      return &cb;
+  }
+
+  return nullptr;
+}
+
+CDImagePBP::CachedBlock* CDImagePBP::AllocateBlock(u32 block_index)
+{
+  // Never evict blocks which are being decompressed, or the one we're currently reading from.
+  CachedBlock* oldest = nullptr;
+  for (CachedBlock& cb : m_blocks)
+  {
+    if (cb.pending || &cb == m_current_block)
+      continue;
+
+    if (cb.block_index == INVALID_BLOCK)
+    {
+      oldest = &cb;
+      break;
+    }
+
+    if (!oldest || cb.last_access < oldest->last_access)
+      oldest = &cb;
+  }
+
+  DebugAssert(oldest);
+  oldest->block_index = block_index;
+  oldest->last_access = ++m_block_access_counter;
+  oldest->valid = false;
+  return oldest;
+}
+
+const CDImagePBP::CachedBlock* CDImagePBP::GetBlock(u32 block_index)
+{
+  std::unique_lock lock(m_block_mutex);
+
+  CachedBlock* cb = LookupBlock(block_index);
+  if (cb && cb->pending)
+    m_prefetch_done_cv.wait(lock, [cb]() { return !cb->pending; });
+
+  if (!cb || !cb->valid)
+  {
+    if (!cb)
+      cb = AllocateBlock(block_index);
+
+    // Decompressing on this thread, the prefetch thread won't touch it since it's not pending.
+    lock.unlock();
+    const bool result = m_decompressor.Decompress(m_file, m_blockinfo_table[block_index], cb->data.data());
+    lock.lock();
+    if (!result) [[unlikely]]
+    {
+      cb->block_index = INVALID_BLOCK;
+      return nullptr;
+    }
+
+    cb->valid = true;
+  }
+
+  cb->last_access = ++m_block_access_counter;
+  m_current_block = cb;
+  return cb;
+}
+
+void CDImagePBP::QueuePrefetch(u32 block_index)
+{
+  if (block_index >= BLOCK_TABLE_NUM_ENTRIES || m_blockinfo_table[block_index].size == 0)
+    return;
+
+  std::unique_lock lock(m_block_mutex);
+  if (LookupBlock(block_index))
+    return;
+
+  CachedBlock* cb = AllocateBlock(block_index);
+  cb->pending = true;
+  m_prefetch_queue.emplace_back(cb, m_blockinfo_table[block_index]);
+  m_prefetch_cv.notify_one();
+}
+
+void CDImagePBP::StartPrefetchThread()
+{
+  if (!m_prefetch_file)
+  {
+    m_prefetch_file = FileSystem::OpenSharedCFile(m_filename.c_str(), "rb", FileSystem::FileShareMode::DenyWrite);
+    if (!m_prefetch_file)
+    {
+      WARNING_LOG("Failed to open second file handle, block prefetching will be disabled.");
+      return;
+    }
+  }
+
+  m_prefetch_shutdown = false;
+  m_prefetch_thread = std::thread(&CDImagePBP::PrefetchThreadEntryPoint, this);
+}
+
+void CDImagePBP::StopPrefetchThread()
+{
+  if (!m_prefetch_thread.joinable())
+    return;
+
+  {
+    std::unique_lock lock(m_block_mutex);
+    m_prefetch_shutdown = true;
+    m_prefetch_cv.notify_one();
+  }
+
+  m_prefetch_thread.join();
+}
+
+void CDImagePBP::PrefetchThreadEntryPoint()
+{
+  BlockDecompressor decompressor;
+  const bool decompressor_valid = decompressor.Init();
+
+  std::unique_lock lock(m_block_mutex);
+  for (;;)
+  {
+    m_prefetch_cv.wait(lock, [this]() { return (m_prefetch_shutdown || !m_prefetch_queue.empty()); });
+    if (m_prefetch_shutdown)
+      break;
+
+    const auto [cb, block_info] = m_prefetch_queue.front();
+    m_prefetch_queue.pop_front();
+    lock.unlock();
+
+    const bool result = decompressor_valid && decompressor.Decompress(m_prefetch_file, block_info, cb->data.data());
+
+    lock.lock();
+    cb->pending = false;
+    cb->valid = result;
+    m_prefetch_done_cv.notify_all();
+  }
+
+  // Anything left in the queue never got decompressed.
+  for (const auto& it : m_prefetch_queue)
+  {
+    it.first->pending = false;
+    it.first->block_index = INVALID_BLOCK;
+  }
+  m_prefetch_queue.clear();
+  m_prefetch_done_cv.notify_all();
+}
+
+void CDImagePBP::FlushBlockCache()
+{
+  // The prefetch thread is restarted on demand, for the new disc.
+  StopPrefetchThread();
+
+  for (CachedBlock& cb : m_blocks)
+  {
+    cb.block_index = INVALID_BLOCK;
+    cb.valid = false;
+    cb.pending = false;
+  }
+
+  m_current_block = nullptr;
+  m_last_requested_block = INVALID_BLOCK;
+}
+
 bool CDImagePBP::ReadSubChannelQ(SubChannelQ* subq, const Index& index, LBA lba_in_index)
 {
   if (m_sbi.GetReplacementSubChannelQ(index.start_lba_on_disc + lba_in_index, subq))
@@ -835,7 +1053,7 @@ bool CDImagePBP::ReadSectorFromIndex(void* buffer, const Index& index, LBA lba_i
   const u32 offset_in_block = offset_in_file % DECOMPRESSED_BLOCK_SIZE;
   const u32 requested_block = offset_in_file / DECOMPRESSED_BLOCK_SIZE;
 
-  BlockInfo& bi = m_blockinfo_table[requested_block];
+  const BlockInfo& bi = m_blockinfo_table[requested_block];
 
   if (bi.size == 0) [[unlikely]]
   {
@@ -843,13 +1061,33 @@ bool CDImagePBP::ReadSectorFromIndex(void* buffer, const Index& index, LBA lba_i
     return false;
   }
 
-  if (m_current_block != requested_block && !DecompressBlock(bi)) [[unlikely]]
+  const CachedBlock* cb = m_current_block;
+  if (!cb || cb->block_index != requested_block)
   {
-    ERROR_LOG("Failed to decompress block {}", requested_block);
-    return false;
+    cb = GetBlock(requested_block);
+    if (!cb) [[unlikely]]
+    {
+      ERROR_LOG("Failed to decompress block {}", requested_block);
+      return false;
+    }
+
+    // Sequential reads (e.g. FMVs/XA), decompress the next blocks in the background.
+    if (m_last_requested_block != INVALID_BLOCK && requested_block == (m_last_requested_block + 1))
+    {
+      if (!m_prefetch_thread.joinable())
+        StartPrefetchThread();
+
+      if (m_prefetch_thread.joinable())
+      {
+        for (u32 i = 1; i <= PREFETCH_BLOCK_COUNT; i++)
+          QueuePrefetch(requested_block + i);
+      }
+    }
+
+    m_last_requested_block = requested_block;
   }
 
-  std::memcpy(buffer, &m_decompressed_block[offset_in_block], RAW_SECTOR_SIZE);
+  std::memcpy(buffer, &cb->data[offset_in_block], RAW_SECTOR_SIZE);
   return true;
 }
 
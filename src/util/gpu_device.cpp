@@ -780,6 +780,11 @@ std::unique_ptr<GPUShader> GPUDevice::CreateShader(GPUShaderStage stage, GPUShad
                                                    std::string_view source, Error* error /* = nullptr */,
                                                    const char* entry_point /* = "main" */)
 {
+  const Common::Timer::Value start_time = Common::Timer::GetCurrentValue();
+  const ScopedGuard compile_time_guard = [start_time]() {
+    s_stats.shader_compile_time += Common::Timer::GetCurrentValue() - start_time;
+  };
+
   std::unique_ptr<GPUShader> shader;
   if (!m_shader_cache.IsOpen())
   {
@@ -511,6 +511,7 @@ public:
     u32 num_copies;
     u32 num_downloads;
     u32 num_uploads;
+    u64 shader_compile_time; // Common::Timer ticks
   };
 
   struct AdapterInfo
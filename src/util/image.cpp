@@ -186,26 +186,6 @@ std::optional<std::vector<u8>> RGBA8Image::SaveToBuffer(std::string_view filenam
   return ret;
 }
 
-#if 0
-
-void RGBA8Image::Resize(u32 new_width, u32 new_height)
-{
-  if (m_width == new_width && m_height == new_height)
-    return;
-
-  std::vector<u32> resized_texture_data(new_width * new_height);
-  u32 resized_texture_stride = sizeof(u32) * new_width;
-  if (!stbir_resize_uint8(reinterpret_cast<u8*>(m_pixels.data()), m_width, m_height, GetPitch(),
-                          reinterpret_cast<u8*>(resized_texture_data.data()), new_width, new_height,
-                          resized_texture_stride, 4))
-  {
-    Panic("stbir_resize_uint8 failed");
-    return;
-  }
-
-  SetPixels(new_width, new_height, std::move(resized_texture_data));
-}
-
 void RGBA8Image::Resize(const RGBA8Image* src_image, u32 new_width, u32 new_height)
 {
   if (src_image->m_width == new_width && src_image->m_height == new_height)
@@ -214,18 +194,39 @@ void RGBA8Image::Resize(const RGBA8Image* src_image, u32 new_width, u32 new_heig
     return;
   }
 
+  // Box filter, each destination pixel is the average of the source pixels it covers. When upscaling, that's
+  // always a single source pixel, so it degrades to nearest-neighbor.
   SetSize(new_width, new_height);
-  if (!stbir_resize_uint8(reinterpret_cast<const u8*>(src_image->m_pixels.data()), src_image->m_width,
-                          src_image->m_height, src_image->GetPitch(), reinterpret_cast<u8*>(m_pixels.data()), new_width,
-                          new_height, GetPitch(), 4))
+  for (u32 dy = 0; dy < new_height; dy++)
   {
-    Panic("stbir_resize_uint8 failed");
-    return;
+    const u32 sy_start = (dy * src_image->m_height) / new_height;
+    const u32 sy_end = std::max(((dy + 1) * src_image->m_height) / new_height, sy_start + 1);
+    for (u32 dx = 0; dx < new_width; dx++)
+    {
+      const u32 sx_start = (dx * src_image->m_width) / new_width;
+      const u32 sx_end = std::max(((dx + 1) * src_image->m_width) / new_width, sx_start + 1);
+
+      u32 sum[4] = {};
+      for (u32 sy = sy_start; sy < sy_end; sy++)
+      {
+        const u32* row = src_image->GetRowPixels(sy);
+        for (u32 sx = sx_start; sx < sx_end; sx++)
+        {
+          const u32 pixel = row[sx];
+          sum[0] += pixel & 0xFF;
+          sum[1] += (pixel >> 8) & 0xFF;
+          sum[2] += (pixel >> 16) & 0xFF;
+          sum[3] += pixel >> 24;
+        }
+      }
+
+      const u32 count = (sy_end - sy_start) * (sx_end - sx_start);
+      SetPixel(dx, dy,
+               (sum[0] / count) | ((sum[1] / count) << 8) | ((sum[2] / count) << 16) | ((sum[3] / count) << 24));
+    }
   }
 }
 
-#endif
-
 static bool PNGCommonLoader(RGBA8Image* image, png_structp png_ptr, png_infop info_ptr, std::vector<u32>& new_data,
                             std::vector<png_bytep>& row_pointers)
 {
@@ -133,4 +133,7 @@ public:
   bool SaveToFile(const char* filename, u8 quality = DEFAULT_SAVE_QUALITY) const;
   bool SaveToFile(std::string_view filename, std::FILE* fp, u8 quality = DEFAULT_SAVE_QUALITY) const;
   std::optional<std::vector<u8>> SaveToBuffer(std::string_view filename, u8 quality = DEFAULT_SAVE_QUALITY) const;
+
+  /// Replaces this image with a box-filtered copy of src_image. Intended for downscaling.
+  void Resize(const RGBA8Image* src_image, u32 new_width, u32 new_height);
 };
@@ -8,14 +8,16 @@
 #include "imgui_manager.h"
 
 #include "common/assert.h"
+#include "common/binary_reader_writer.h"
 #include "common/easing.h"
 #include "common/error.h"
 #include "common/file_system.h"
+#include "common/heterogeneous_containers.h"
 #include "common/log.h"
 #include "common/lru_cache.h"
 #include "common/path.h"
 #include "common/string_util.h"
-#include "common/threading.h"
+#include "common/task_scheduler.h"
 #include "common/timer.h"
 
 #include "core/host.h"
@@ -28,10 +30,8 @@
 
 #include <array>
 #include <cmath>
-#include <condition_variable>
 #include <deque>
 #include <mutex>
-#include <thread>
 #include <utility>
 #include <variant>
 
@@ -44,7 +44,19 @@ static constexpr float MENU_BACKGROUND_ANIMATION_TIME = 0.5f;
 
 static std::optional<RGBA8Image> LoadTextureImage(std::string_view path);
 static std::shared_ptr<GPUTexture> UploadTexture(std::string_view path, const RGBA8Image& image);
-static void TextureLoaderThread();
+static void LoadTextureAsync(std::string path);
+
+static bool OpenThumbnailCache(std::string_view path);
+static bool LoadThumbnailCacheIndex();
+static bool InitializeThumbnailCacheFile();
+static void CloseThumbnailCache();
+static std::optional<RGBA8Image> ReadThumbnailFromCache(const std::string& path, u64 modification_time);
+static void WriteThumbnailToCache(const std::string& path, u64 modification_time, const RGBA8Image& image);
+static std::optional<RGBA8Image> LoadThumbnailImage(const std::string& path);
+static void LoadThumbnailAsync(std::string path, u32 slot_index);
+static s32 AllocateThumbnailSlot(u32 frame);
+static void UploadAsyncThumbnails();
+static ThumbnailInfo GetPlaceholderThumbnailInfo();
 
 static void DrawFileSelector();
 static void DrawChoiceDialog();
@@ -93,12 +105,64 @@ static bool s_light_theme = false;
 
 static LRUCache<std::string, std::shared_ptr<GPUTexture>> s_texture_cache(128, true);
 static std::shared_ptr<GPUTexture> s_placeholder_texture;
-static std::atomic_bool s_texture_load_thread_quit{false};
+static std::atomic_bool s_texture_load_quit{false};
 static std::mutex s_texture_load_mutex;
-static std::condition_variable s_texture_load_cv;
-static std::deque<std::string> s_texture_load_queue;
 static std::deque<std::pair<std::string, RGBA8Image>> s_texture_upload_queue;
-static std::thread s_texture_load_thread;
+static TaskGroup s_texture_load_tasks;
+
+// Thumbnails are packed into fixed-size slots in a handful of atlases, which are only created when needed.
+static constexpr u32 THUMBNAIL_SIZE = 256;
+static constexpr u32 THUMBNAIL_ATLAS_SIZE = 2048;
+static constexpr u32 THUMBNAIL_SLOTS_PER_ROW = THUMBNAIL_ATLAS_SIZE / THUMBNAIL_SIZE;
+static constexpr u32 THUMBNAIL_SLOTS_PER_ATLAS = THUMBNAIL_SLOTS_PER_ROW * THUMBNAIL_SLOTS_PER_ROW;
+static constexpr u32 MAX_THUMBNAIL_ATLASES = 4;
+
+static constexpr u32 THUMBNAIL_CACHE_SIGNATURE = 0x4E4D4854;
+static constexpr u32 THUMBNAIL_CACHE_VERSION = 1;
+static constexpr s64 MAX_THUMBNAIL_CACHE_SIZE = 256 * 1024 * 1024;
+
+namespace {
+enum class ThumbnailState : u8
+{
+  Empty,
+  Loading,
+  Loaded,
+  Failed,
+};
+
+struct ThumbnailSlot
+{
+  std::string path;
+  u32 last_used_frame;
+  u16 width;
+  u16 height;
+  ThumbnailState state;
+};
+
+struct ThumbnailUpload
+{
+  u32 slot_index;
+  std::string path;
+  std::optional<RGBA8Image> image;
+};
+
+struct ThumbnailCacheEntry
+{
+  u64 modification_time;
+  s64 offset;
+  u32 size;
+};
+} // namespace
+
+static std::array<std::unique_ptr<GPUTexture>, MAX_THUMBNAIL_ATLASES> s_thumbnail_atlases;
+static std::vector<ThumbnailSlot> s_thumbnail_slots;
+static PreferUnorderedStringMap<u32> s_thumbnail_slot_map;
+static std::deque<ThumbnailUpload> s_thumbnail_upload_queue;
+
+// The on-disk cache is shared by all of the load tasks.
+static std::mutex s_thumbnail_cache_mutex;
+static FileSystem::ManagedCFilePtr s_thumbnail_cache_file;
+static PreferUnorderedStringMap<ThumbnailCacheEntry> s_thumbnail_cache_index;
 
 static SmallString s_fullscreen_footer_text;
 static SmallString s_last_fullscreen_footer_text;
@@ -209,7 +273,7 @@ void ImGuiFullscreen::SetFonts(ImFont* standard_font, ImFont* medium_font, ImFon
   g_large_font = large_font;
 }
 
-bool ImGuiFullscreen::Initialize(const char* placeholder_image_path)
+bool ImGuiFullscreen::Initialize(const char* placeholder_image_path, std::string_view thumbnail_cache_path /* = {} */)
 {
   s_focus_reset_queued = FocusResetType::ViewChanged;
   s_close_button_state = 0;
@@ -221,25 +285,27 @@ bool ImGuiFullscreen::Initialize(const char* placeholder_image_path)
     return false;
   }
 
-  s_texture_load_thread_quit.store(false, std::memory_order_release);
-  s_texture_load_thread = std::thread(TextureLoaderThread);
+  if (!thumbnail_cache_path.empty())
+    OpenThumbnailCache(thumbnail_cache_path);
+
+  s_texture_load_quit.store(false, std::memory_order_release);
   ResetMenuButtonFrame();
   return true;
 }
 
 void ImGuiFullscreen::Shutdown()
 {
-  if (s_texture_load_thread.joinable())
-  {
-    {
-      std::unique_lock lock(s_texture_load_mutex);
-      s_texture_load_thread_quit.store(true, std::memory_order_release);
-      s_texture_load_cv.notify_one();
-    }
-    s_texture_load_thread.join();
-  }
+  // Loads which haven't started yet are skipped.
+  s_texture_load_quit.store(true, std::memory_order_release);
+  s_texture_load_tasks.Wait();
 
   s_texture_upload_queue.clear();
+  s_thumbnail_upload_queue.clear();
+  s_thumbnail_slot_map.clear();
+  s_thumbnail_slots.clear();
+  for (std::unique_ptr<GPUTexture>& atlas : s_thumbnail_atlases)
+    atlas.reset();
+  CloseThumbnailCache();
   s_placeholder_texture.reset();
   g_standard_font = nullptr;
   g_medium_font = nullptr;
@@ -383,9 +449,8 @@ GPUTexture* ImGuiFullscreen::GetCachedTextureAsync(std::string_view name)
     tex_ptr = s_texture_cache.Insert(std::string(name), s_placeholder_texture);
 
     // queue the actual load
-    std::unique_lock lock(s_texture_load_mutex);
-    s_texture_load_queue.emplace_back(name);
-    s_texture_load_cv.notify_one();
+    s_texture_load_tasks.Submit([path = std::string(name)]() mutable { LoadTextureAsync(std::move(path)); },
+                                TaskScheduler::Priority::Low);
   }
 
   return tex_ptr->get();
@@ -393,6 +458,15 @@ GPUTexture* ImGuiFullscreen::GetCachedTextureAsync(std::string_view name)
 
 bool ImGuiFullscreen::InvalidateCachedTexture(const std::string& path)
 {
+  // Any load in flight for the thumbnail will be dropped, since the slot no longer matches.
+  if (const auto it = s_thumbnail_slot_map.find(path); it != s_thumbnail_slot_map.end())
+  {
+    ThumbnailSlot& slot = s_thumbnail_slots[it->second];
+    slot.path = {};
+    slot.state = ThumbnailState::Empty;
+    s_thumbnail_slot_map.erase(it);
+  }
+
   return s_texture_cache.Remove(path);
 }
 
@@ -411,39 +485,365 @@ void ImGuiFullscreen::UploadAsyncTextures()
 
     lock.lock();
   }
+  lock.unlock();
+
+  UploadAsyncThumbnails();
 }
 
-void ImGuiFullscreen::TextureLoaderThread()
+void ImGuiFullscreen::LoadTextureAsync(std::string path)
 {
-  Threading::SetNameOfCurrentThread("ImGuiFullscreen Texture Loader");
+  if (s_texture_load_quit.load(std::memory_order_acquire))
+    return;
+
+  // don't bother queuing back if it doesn't exist
+  std::optional<RGBA8Image> image(LoadTextureImage(path.c_str()));
+  if (!image)
+    return;
 
   std::unique_lock lock(s_texture_load_mutex);
+  s_texture_upload_queue.emplace_back(std::move(path), std::move(image.value()));
+}
 
-  for (;;)
+bool ImGuiFullscreen::OpenThumbnailCache(std::string_view path)
+{
+  Error error;
+  std::unique_lock lock(s_thumbnail_cache_mutex);
+  s_thumbnail_cache_file = FileSystem::OpenExistingOrCreateManagedCFile(std::string(path).c_str(), 0, &error);
+  if (!s_thumbnail_cache_file)
   {
-    s_texture_load_cv.wait(lock, []() {
-      return (s_texture_load_thread_quit.load(std::memory_order_acquire) || !s_texture_load_queue.empty());
-    });
+    WARNING_LOG("Failed to open thumbnail cache: {}", error.GetDescription());
+    return false;
+  }
+
+  if (!LoadThumbnailCacheIndex() && !InitializeThumbnailCacheFile())
+  {
+    s_thumbnail_cache_file.reset();
+    return false;
+  }
+
+  DEV_LOG("Read {} entries from thumbnail cache", s_thumbnail_cache_index.size());
+  return true;
+}
+
+bool ImGuiFullscreen::LoadThumbnailCacheIndex()
+{
+  std::FILE* fp = s_thumbnail_cache_file.get();
+  const s64 file_size = FileSystem::FSize64(fp);
+  BinaryFileReader reader(fp);
+  if (file_size <= 0)
+    return false;
+
+  u32 file_signature, file_version;
+  if (!reader.ReadU32(&file_signature) || !reader.ReadU32(&file_version) ||
+      file_signature != THUMBNAIL_CACHE_SIGNATURE || file_version != THUMBNAIL_CACHE_VERSION)
+  {
+    WARNING_LOG("Thumbnail cache is corrupted or from an older version");
+    return false;
+  }
+
+  // Entries are only ever appended, so a later entry for the same path replaces the earlier one.
+  while (!reader.IsAtEnd())
+  {
+    std::string path;
+    ThumbnailCacheEntry entry;
+    if (!reader.ReadSizePrefixedString(&path) || !reader.ReadU64(&entry.modification_time) ||
+        !reader.ReadU32(&entry.size) || (entry.offset = FileSystem::FTell64(fp)) < 0 ||
+        (entry.offset + entry.size) > file_size || FileSystem::FSeek64(fp, entry.size, SEEK_CUR) != 0)
+    {
+      WARNING_LOG("Thumbnail cache entry is corrupted");
+      s_thumbnail_cache_index.clear();
+      return false;
+    }
+
+    s_thumbnail_cache_index.insert_or_assign(std::move(path), entry);
+  }
+
+  return true;
+}
+
+bool ImGuiFullscreen::InitializeThumbnailCacheFile()
+{
+  INFO_LOG("Initializing thumbnail cache.");
+  s_thumbnail_cache_index.clear();
+
+  Error error;
+  std::FILE* fp = s_thumbnail_cache_file.get();
+  if (!FileSystem::FSeek64(fp, 0, SEEK_SET, &error) || !FileSystem::FTruncate64(fp, 0, &error))
+  {
+    ERROR_LOG("Failed to truncate thumbnail cache: {}", error.GetDescription());
+    return false;
+  }
+
+  BinaryFileWriter writer(fp);
+  writer.WriteU32(THUMBNAIL_CACHE_SIGNATURE);
+  writer.WriteU32(THUMBNAIL_CACHE_VERSION);
+  if (!writer.Flush(&error))
+  {
+    ERROR_LOG("Failed to write thumbnail cache header: {}", error.GetDescription());
+    return false;
+  }
+
+  return true;
+}
+
+void ImGuiFullscreen::CloseThumbnailCache()
+{
+  std::unique_lock lock(s_thumbnail_cache_mutex);
+  s_thumbnail_cache_file.reset();
+  s_thumbnail_cache_index.clear();
+}
+
+std::optional<RGBA8Image> ImGuiFullscreen::ReadThumbnailFromCache(const std::string& path, u64 modification_time)
+{
+  std::optional<RGBA8Image> image;
+  std::vector<u8> data;
+  {
+    std::unique_lock lock(s_thumbnail_cache_mutex);
+    const auto it = s_thumbnail_cache_index.find(path);
+    if (!s_thumbnail_cache_file || it == s_thumbnail_cache_index.end() ||
+        it->second.modification_time != modification_time)
+    {
+      return image;
+    }
+
+    data.resize(it->second.size);
+    if (FileSystem::FSeek64(s_thumbnail_cache_file.get(), it->second.offset, SEEK_SET) != 0 ||
+        std::fread(data.data(), data.size(), 1, s_thumbnail_cache_file.get()) != 1)
+    {
+      ERROR_LOG("Failed to read cached thumbnail for '{}'", Path::GetFileName(path));
+      return image;
+    }
+  }
+
+  image = RGBA8Image();
+  if (!image->LoadFromBuffer("thumbnail.webp", data.data(), data.size()))
+  {
+    ERROR_LOG("Failed to decode cached thumbnail for '{}'", Path::GetFileName(path));
+    image.reset();
+  }
+
+  return image;
+}
+
+void ImGuiFullscreen::WriteThumbnailToCache(const std::string& path, u64 modification_time, const RGBA8Image& image)
+{
+  const std::optional<std::vector<u8>> data = image.SaveToBuffer("thumbnail.webp");
+  if (!data.has_value())
+  {
+    ERROR_LOG("Failed to encode thumbnail for '{}'", Path::GetFileName(path));
+    return;
+  }
+
+  std::unique_lock lock(s_thumbnail_cache_mutex);
+  std::FILE* fp = s_thumbnail_cache_file.get();
+  if (!fp || FileSystem::FSeek64(fp, 0, SEEK_END) != 0)
+    return;
+
+  // Replaced entries are never reclaimed, so start over once the file gets too big.
+  if ((FileSystem::FTell64(fp) + static_cast<s64>(data->size())) > MAX_THUMBNAIL_CACHE_SIZE &&
+      !InitializeThumbnailCacheFile())
+  {
+    s_thumbnail_cache_file.reset();
+    return;
+  }
+
+  ThumbnailCacheEntry entry;
+  entry.modification_time = modification_time;
+  entry.size = static_cast<u32>(data->size());
 
-    if (s_texture_load_thread_quit.load(std::memory_order_acquire))
-      break;
+  Error error;
+  BinaryFileWriter writer(fp);
+  writer.WriteSizePrefixedString(path);
+  writer.WriteU64(modification_time);
+  writer.WriteU32(entry.size);
+  entry.offset = FileSystem::FTell64(fp);
+  writer.Write(data->data(), data->size());
+  if (!writer.Flush(&error))
+  {
+    ERROR_LOG("Failed to write thumbnail to cache: {}", error.GetDescription());
+    return;
+  }
 
-    while (!s_texture_load_queue.empty())
+  s_thumbnail_cache_index.insert_or_assign(path, entry);
+}
+
+std::optional<RGBA8Image> ImGuiFullscreen::LoadThumbnailImage(const std::string& path)
+{
+  // Resources are cheap to load, and don't have a timestamp to key them by.
+  FILESYSTEM_STAT_DATA sd;
+  const bool use_cache = (Path::IsAbsolute(path) && FileSystem::StatFile(path.c_str(), &sd));
+  const u64 modification_time = use_cache ? static_cast<u64>(sd.ModificationTime) : 0;
+  std::optional<RGBA8Image> image;
+  if (use_cache && (image = ReadThumbnailFromCache(path, modification_time)).has_value())
+    return image;
+
+  image = LoadTextureImage(path);
+  if (!image.has_value())
+    return image;
+
+  if (image->GetWidth() > THUMBNAIL_SIZE || image->GetHeight() > THUMBNAIL_SIZE)
+  {
+    const float scale = std::min(static_cast<float>(THUMBNAIL_SIZE) / static_cast<float>(image->GetWidth()),
+                                 static_cast<float>(THUMBNAIL_SIZE) / static_cast<float>(image->GetHeight()));
+    const u32 width = std::clamp(static_cast<u32>(std::round(static_cast<float>(image->GetWidth()) * scale)), 1u,
+                                 THUMBNAIL_SIZE);
+    const u32 height = std::clamp(static_cast<u32>(std::round(static_cast<float>(image->GetHeight()) * scale)), 1u,
+                                  THUMBNAIL_SIZE);
+    RGBA8Image resized;
+    resized.Resize(&image.value(), width, height);
+    image = std::move(resized);
+  }
+
+  if (use_cache)
+    WriteThumbnailToCache(path, modification_time, image.value());
+
+  return image;
+}
+
+void ImGuiFullscreen::LoadThumbnailAsync(std::string path, u32 slot_index)
+{
+  if (s_texture_load_quit.load(std::memory_order_acquire))
+    return;
+
+  // Failures are queued too, so the slot can stop showing the placeholder.
+  std::optional<RGBA8Image> image(LoadThumbnailImage(path));
+  std::unique_lock lock(s_texture_load_mutex);
+  s_thumbnail_upload_queue.push_back(ThumbnailUpload{slot_index, std::move(path), std::move(image)});
+}
+
+s32 ImGuiFullscreen::AllocateThumbnailSlot(u32 frame)
+{
+  // Slots drawn this frame, or with a load in flight, can't be reused.
+  s32 lru_index = -1;
+  for (u32 i = 0; i < static_cast<u32>(s_thumbnail_slots.size()); i++)
+  {
+    const ThumbnailSlot& slot = s_thumbnail_slots[i];
+    if (slot.state == ThumbnailState::Empty)
+      return static_cast<s32>(i);
+    else if (slot.state == ThumbnailState::Loading || slot.last_used_frame == frame)
+      continue;
+
+    if (lru_index < 0 || slot.last_used_frame < s_thumbnail_slots[lru_index].last_used_frame)
+      lru_index = static_cast<s32>(i);
+  }
+
+  // Prefer growing to evicting, until we hit the memory limit.
+  const u32 num_atlases = static_cast<u32>(s_thumbnail_slots.size()) / THUMBNAIL_SLOTS_PER_ATLAS;
+  if (num_atlases < MAX_THUMBNAIL_ATLASES)
+  {
+    std::unique_ptr<GPUTexture> atlas =
+      g_gpu_device->CreateTexture(THUMBNAIL_ATLAS_SIZE, THUMBNAIL_ATLAS_SIZE, 1, 1, 1, GPUTexture::Type::Texture,
+                                  GPUTexture::Format::RGBA8);
+    if (atlas)
     {
-      std::string path(std::move(s_texture_load_queue.front()));
-      s_texture_load_queue.pop_front();
+      DEV_LOG("Created thumbnail atlas {}", num_atlases);
+      s_thumbnail_atlases[num_atlases] = std::move(atlas);
+      s_thumbnail_slots.resize(s_thumbnail_slots.size() + THUMBNAIL_SLOTS_PER_ATLAS,
+                               ThumbnailSlot{{}, 0, 0, 0, ThumbnailState::Empty});
+      return static_cast<s32>(num_atlases * THUMBNAIL_SLOTS_PER_ATLAS);
+    }
 
-      lock.unlock();
-      std::optional<RGBA8Image> image(LoadTextureImage(path.c_str()));
-      lock.lock();
+    ERROR_LOG("Failed to create {}x{} thumbnail atlas", THUMBNAIL_ATLAS_SIZE, THUMBNAIL_ATLAS_SIZE);
+  }
 
-      // don't bother queuing back if it doesn't exist
-      if (image)
-        s_texture_upload_queue.emplace_back(std::move(path), std::move(image.value()));
+  if (lru_index >= 0)
+  {
+    ThumbnailSlot& slot = s_thumbnail_slots[lru_index];
+    s_thumbnail_slot_map.erase(slot.path);
+    slot.path = {};
+    slot.state = ThumbnailState::Empty;
+  }
+
+  return lru_index;
+}
+
+void ImGuiFullscreen::UploadAsyncThumbnails()
+{
+  std::unique_lock lock(s_texture_load_mutex);
+  while (!s_thumbnail_upload_queue.empty())
+  {
+    ThumbnailUpload upload(std::move(s_thumbnail_upload_queue.front()));
+    s_thumbnail_upload_queue.pop_front();
+    lock.unlock();
+
+    // The slot may have been invalidated while the image was loading.
+    if (upload.slot_index < s_thumbnail_slots.size())
+    {
+      ThumbnailSlot& slot = s_thumbnail_slots[upload.slot_index];
+      if (slot.state == ThumbnailState::Loading && slot.path == upload.path)
+      {
+        GPUTexture* atlas = s_thumbnail_atlases[upload.slot_index / THUMBNAIL_SLOTS_PER_ATLAS].get();
+        const u32 atlas_slot = upload.slot_index % THUMBNAIL_SLOTS_PER_ATLAS;
+        const u32 x = (atlas_slot % THUMBNAIL_SLOTS_PER_ROW) * THUMBNAIL_SIZE;
+        const u32 y = (atlas_slot / THUMBNAIL_SLOTS_PER_ROW) * THUMBNAIL_SIZE;
+        if (upload.image.has_value() && atlas->Update(x, y, upload.image->GetWidth(), upload.image->GetHeight(),
+                                                      upload.image->GetPixels(), upload.image->GetPitch()))
+        {
+          slot.width = static_cast<u16>(upload.image->GetWidth());
+          slot.height = static_cast<u16>(upload.image->GetHeight());
+          slot.state = ThumbnailState::Loaded;
+        }
+        else
+        {
+          slot.state = ThumbnailState::Failed;
+        }
+      }
     }
+
+    lock.lock();
+  }
+}
+
+ImGuiFullscreen::ThumbnailInfo ImGuiFullscreen::GetPlaceholderThumbnailInfo()
+{
+  GPUTexture* const tex = s_placeholder_texture.get();
+  return ThumbnailInfo{tex, ImVec2(0.0f, 0.0f), ImVec2(1.0f, 1.0f),
+                       ImVec2(static_cast<float>(tex->GetWidth()), static_cast<float>(tex->GetHeight()))};
+}
+
+ImGuiFullscreen::ThumbnailInfo ImGuiFullscreen::GetCachedThumbnailAsync(std::string_view path)
+{
+  const u32 frame = static_cast<u32>(ImGui::GetFrameCount());
+  if (const auto it = s_thumbnail_slot_map.find(path); it != s_thumbnail_slot_map.end())
+  {
+    ThumbnailSlot& slot = s_thumbnail_slots[it->second];
+    slot.last_used_frame = frame;
+    if (slot.state != ThumbnailState::Loaded)
+      return GetPlaceholderThumbnailInfo();
+
+    // Inset by half a texel, so filtering doesn't pull in the neighbouring slots.
+    static constexpr float rcp_atlas_size = 1.0f / static_cast<float>(THUMBNAIL_ATLAS_SIZE);
+    const u32 atlas_slot = it->second % THUMBNAIL_SLOTS_PER_ATLAS;
+    const float x = static_cast<float>((atlas_slot % THUMBNAIL_SLOTS_PER_ROW) * THUMBNAIL_SIZE);
+    const float y = static_cast<float>((atlas_slot / THUMBNAIL_SLOTS_PER_ROW) * THUMBNAIL_SIZE);
+    const float width = static_cast<float>(slot.width);
+    const float height = static_cast<float>(slot.height);
+    return ThumbnailInfo{s_thumbnail_atlases[it->second / THUMBNAIL_SLOTS_PER_ATLAS].get(),
+                         ImVec2((x + 0.5f) * rcp_atlas_size, (y + 0.5f) * rcp_atlas_size),
+                         ImVec2((x + width - 0.5f) * rcp_atlas_size, (y + height - 0.5f) * rcp_atlas_size),
+                         ImVec2(width, height)};
   }
 
-  s_texture_load_queue.clear();
+  // Everything is in use this frame? Try again next frame.
+  const s32 slot_index = AllocateThumbnailSlot(frame);
+  if (slot_index < 0)
+    return GetPlaceholderThumbnailInfo();
+
+  ThumbnailSlot& slot = s_thumbnail_slots[slot_index];
+  slot.path = path;
+  slot.last_used_frame = frame;
+  slot.width = 0;
+  slot.height = 0;
+  slot.state = ThumbnailState::Loading;
+  s_thumbnail_slot_map.emplace(slot.path, static_cast<u32>(slot_index));
+
+  s_texture_load_tasks.Submit(
+    [path = std::string(path), slot_index = static_cast<u32>(slot_index)]() mutable {
+      LoadThumbnailAsync(std::move(path), slot_index);
+    },
+    TaskScheduler::Priority::Low);
+
+  return GetPlaceholderThumbnailInfo();
 }
 
 bool ImGuiFullscreen::UpdateLayoutScale()
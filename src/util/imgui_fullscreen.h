@@ -117,8 +117,8 @@ ALWAYS_INLINE static std::string_view RemoveHash(std::string_view s)
 ImRect CenterImage(const ImVec2& fit_size, const ImVec2& image_size);
 ImRect CenterImage(const ImRect& fit_rect, const ImVec2& image_size);
 
-/// Initializes, setting up any state.
-bool Initialize(const char* placeholder_image_path);
+/// Initializes, setting up any state. Thumbnails are persisted to thumbnail_cache_path, if it is not empty.
+bool Initialize(const char* placeholder_image_path, std::string_view thumbnail_cache_path = {});
 
 void SetTheme(bool light);
 void SetFonts(ImFont* standard_font, ImFont* medium_font, ImFont* large_font);
@@ -136,6 +136,18 @@ GPUTexture* GetCachedTextureAsync(std::string_view name);
 bool InvalidateCachedTexture(const std::string& path);
 void UploadAsyncTextures();
 
+/// Thumbnails are scaled-down copies of images, packed into shared atlas textures.
+struct ThumbnailInfo
+{
+  GPUTexture* texture;
+  ImVec2 uv0;
+  ImVec2 uv1;
+  ImVec2 size;
+};
+
+/// Returns the thumbnail for the image at path, or the placeholder texture if it is still being loaded.
+ThumbnailInfo GetCachedThumbnailAsync(std::string_view path);
+
 void BeginLayout();
 void EndLayout();
 
@@ -23,8 +23,8 @@
 #include <atomic>
 #include <memory>
 #include <mutex>
+#include <span>
 #include <sstream>
-#include <unordered_map>
 #include <variant>
 #include <vector>
 
@@ -59,6 +59,33 @@ struct InputBinding
   u8 num_keys = 0;
   u8 full_mask = 0;
   u8 current_mask = 0;
+  bool controller_binding = false;
+};
+
+// ------------------------------------------------------------------------
+// Binding Table
+// ------------------------------------------------------------------------
+// Immutable snapshot of the bindings, sorted by key so an event only has to
+// binary search one contiguous array. Each entry has the chord key and the
+// handler already resolved, so dispatch doesn't need to look at the variant.
+// The table is swapped when the bindings change, and old tables are only
+// freed once no thread is reading from them. The bindings themselves are
+// shared between tables, so the chord state survives an AddBinding().
+
+struct BindingTableEntry
+{
+  u64 key_bits; ///< Key with the direction masked out.
+  InputBinding* binding;
+  const InputAxisEventHandler* axis_handler;
+  const InputButtonEventHandler* button_handler;
+  u8 key_index;            ///< Index of the key in the binding's chord.
+  bool sub_frame_safe;     ///< Controller binding whose keys aren't shared with others, so it can fire mid-frame.
+};
+
+struct BindingTable
+{
+  std::vector<BindingTableEntry> entries;
+  std::vector<std::shared_ptr<InputBinding>> bindings;
 };
 
 struct PadVibrationBinding
@@ -94,6 +121,17 @@ struct MacroButton
   bool trigger_toggle;      ///< Whether the macro is trigged by holding or press.
 };
 
+// When polling in the middle of a frame, only events for keys used exclusively by controller bindings are handled.
+// Everything else, such as hotkeys which could save state or shut down the system, is queued and replayed at the
+// next frame boundary. Events are deferred whole, so chords are still resolved against every binding for the key.
+struct DeferredInputEvent
+{
+  InputBindingKey key;
+  float value;
+  bool skip_button_handlers;
+  bool clear_bind_state; ///< Source was disconnected, key is only used for the source.
+};
+
 } // namespace
 
 // ------------------------------------------------------------------------
@@ -107,10 +145,13 @@ static std::optional<InputBindingKey> ParseSensorKey(std::string_view source, st
 static std::vector<std::string_view> SplitChord(std::string_view binding);
 static bool SplitBinding(std::string_view binding, std::string_view* source, std::string_view* sub_binding);
 static void PrettifyInputBindingPart(std::string_view binding, SmallString& ret, bool& changed);
-static void AddBindings(const std::vector<std::string>& bindings, const InputEventHandler& handler);
+static void AddBindings(const std::vector<std::string>& bindings, const InputEventHandler& handler,
+                        bool controller_binding);
 static void UpdatePointerCount();
 
-static bool IsAxisHandler(const InputEventHandler& handler);
+static std::span<const BindingTableEntry> FindBindings(const BindingTable* table, InputBindingKey masked_key);
+static void PublishBindingTable();
+static void ReclaimBindingTables();
 static float ApplySingleBindingScale(float sensitivity, float deadzone, float value);
 
 static void AddHotkeyBindings(SettingsInterface& si);
@@ -118,6 +159,8 @@ static void AddPadBindings(SettingsInterface& si, const std::string& section, u3
                            const Controller::ControllerInfo* cinfo);
 static void UpdateContinuedVibration();
 static void GenerateRelativeMouseEvents();
+static void PollSourceEvents();
+static void ReplayDeferredEvents();
 
 static bool DoEventHook(InputBindingKey key, float value);
 static bool PreprocessEvent(InputBindingKey key, float value, GenericInputBinding generic_key);
@@ -136,13 +179,60 @@ static void UpdateInputSourceState(SettingsInterface& si, std::unique_lock<std::
 // Local Variables
 // ------------------------------------------------------------------------
 
-// This is a multimap containing any binds related to the specified key.
-using BindingMap = std::unordered_multimap<InputBindingKey, std::shared_ptr<InputBinding>, InputBindingKeyHash>;
+// Bindings are collected here while reloading, and published as a table once complete.
+// Everything but the published table pointer is protected by the write lock.
 using VibrationBindingArray = std::vector<PadVibrationBinding>;
-static BindingMap s_binding_map;
+static std::vector<std::shared_ptr<InputBinding>> s_bindings;
+static std::unique_ptr<BindingTable> s_current_binding_table;
+static std::vector<std::unique_ptr<BindingTable>> s_retired_binding_tables;
+static std::atomic<const BindingTable*> s_binding_table{nullptr};
+static std::atomic<u32> s_binding_table_readers{0};
+static std::atomic_bool s_has_retired_binding_tables{false};
+static bool s_reloading_bindings = false;
 static VibrationBindingArray s_pad_vibration_array;
 static std::mutex s_binding_map_write_lock;
 
+namespace {
+/// Pins the published binding table for the lifetime of the guard. Readers never block, even while
+/// a handler reloads the bindings underneath them, in which case they keep using the old table.
+class BindingTableReadGuard
+{
+public:
+  ALWAYS_INLINE BindingTableReadGuard()
+  {
+    // Sequentially consistent, so either the writer sees us, or we see its new table.
+    s_binding_table_readers.fetch_add(1);
+    m_table = s_binding_table.load();
+  }
+  ALWAYS_INLINE ~BindingTableReadGuard() { s_binding_table_readers.fetch_sub(1, std::memory_order_release); }
+
+  BindingTableReadGuard(const BindingTableReadGuard&) = delete;
+  BindingTableReadGuard& operator=(const BindingTableReadGuard&) = delete;
+
+  ALWAYS_INLINE const BindingTable* GetTable() const { return m_table; }
+
+private:
+  const BindingTable* m_table;
+};
+
+struct EventDispatchCounters
+{
+  std::atomic<u64> num_events{0};
+  std::atomic<u64> total_time{0};
+  std::atomic<u64> max_time{0};
+  std::atomic<u64> num_reads{0};
+  std::atomic<u64> total_read_latency{0};
+  std::atomic<u64> max_read_latency{0};
+};
+} // namespace
+
+static EventDispatchCounters s_event_dispatch_counters;
+
+static bool s_in_sub_frame_poll = false;
+static std::vector<DeferredInputEvent> s_deferred_events;
+static Common::Timer::Value s_last_poll_time = 0;
+static Common::Timer::Value s_unread_controller_input_time = 0;
+
 // Hooks/intercepting (for setting bindings)
 static std::mutex m_event_intercept_mutex;
 static InputInterceptHook::Callback m_event_intercept_callback;
@@ -488,13 +578,14 @@ void InputManager::PrettifyInputBindingPart(const std::string_view binding, Smal
   ret.append(binding);
 }
 
-void InputManager::AddBindings(const std::vector<std::string>& bindings, const InputEventHandler& handler)
+void InputManager::AddBindings(const std::vector<std::string>& bindings, const InputEventHandler& handler,
+                               bool controller_binding)
 {
   for (const std::string& binding : bindings)
-    AddBinding(binding, handler);
+    AddBinding(binding, handler, controller_binding);
 }
 
-void InputManager::AddBinding(std::string_view binding, const InputEventHandler& handler)
+void InputManager::AddBinding(std::string_view binding, const InputEventHandler& handler, bool controller_binding)
 {
   std::shared_ptr<InputBinding> ibinding;
   const std::vector<std::string_view> chord_bindings(SplitChord(binding));
@@ -513,6 +604,7 @@ void InputManager::AddBinding(std::string_view binding, const InputEventHandler&
     {
       ibinding = std::make_shared<InputBinding>();
       ibinding->handler = handler;
+      ibinding->controller_binding = controller_binding;
     }
 
     if (ibinding->num_keys == MAX_KEYS_PER_BINDING)
@@ -530,9 +622,16 @@ void InputManager::AddBinding(std::string_view binding, const InputEventHandler&
   if (!ibinding)
     return;
 
-  // plop it in the input map for all the keys
-  for (u32 i = 0; i < ibinding->num_keys; i++)
-    s_binding_map.emplace(ibinding->keys[i].MaskDirection(), ibinding);
+  // Bindings added during a reload are published all at once at the end, and the lock is already held.
+  if (s_reloading_bindings)
+  {
+    s_bindings.push_back(std::move(ibinding));
+    return;
+  }
+
+  std::unique_lock lock(s_binding_map_write_lock);
+  s_bindings.push_back(std::move(ibinding));
+  PublishBindingTable();
 }
 
 void InputManager::AddVibrationBinding(u32 pad_index, const InputBindingKey* motor_0_binding,
@@ -815,7 +914,7 @@ void InputManager::AddHotkeyBindings(SettingsInterface& si)
       if (bindings.empty())
         continue;
 
-      AddBindings(bindings, InputButtonEventHandler{hotkey->handler});
+      AddBindings(bindings, InputButtonEventHandler{hotkey->handler}, false);
     }
   }
 }
@@ -847,7 +946,8 @@ void InputManager::AddPadBindings(SettingsInterface& si, const std::string& sect
                         Controller* c = System::GetController(pad_index);
                         if (c)
                           c->SetBindState(bind_index, ApplySingleBindingScale(sensitivity, deadzone, value));
-                      }});
+                      }},
+                      true);
         }
       }
       break;
@@ -899,7 +999,8 @@ void InputManager::AddPadBindings(SettingsInterface& si, const std::string& sect
                       return;
 
                     SetMacroButtonState(pad_index, macro_button_index, state);
-                  }});
+                  }},
+                  true);
     }
   }
 
@@ -942,16 +1043,20 @@ void InputManager::AddPadBindings(SettingsInterface& si, const std::string& sect
 
 bool InputManager::HasAnyBindingsForKey(InputBindingKey key)
 {
-  std::unique_lock lock(s_binding_map_write_lock);
-  return (s_binding_map.find(key.MaskDirection()) != s_binding_map.end());
+  const BindingTableReadGuard guard;
+  return !FindBindings(guard.GetTable(), key.MaskDirection()).empty();
 }
 
 bool InputManager::HasAnyBindingsForSource(InputBindingKey key)
 {
-  std::unique_lock lock(s_binding_map_write_lock);
-  for (const auto& it : s_binding_map)
+  const BindingTableReadGuard guard;
+  if (!guard.GetTable())
+    return false;
+
+  for (const BindingTableEntry& entry : guard.GetTable()->entries)
   {
-    const InputBindingKey& okey = it.first;
+    InputBindingKey okey;
+    okey.bits = entry.key_bits;
     if (okey.source_type == key.source_type && okey.source_index == key.source_index &&
         okey.source_subtype == key.source_subtype)
     {
@@ -962,9 +1067,123 @@ bool InputManager::HasAnyBindingsForSource(InputBindingKey key)
   return false;
 }
 
-bool InputManager::IsAxisHandler(const InputEventHandler& handler)
+std::span<const BindingTableEntry> InputManager::FindBindings(const BindingTable* table, InputBindingKey masked_key)
+{
+  if (!table)
+    return {};
+
+  const BindingTableEntry search = {masked_key.bits, nullptr, nullptr, nullptr, 0, false};
+  const auto range = std::equal_range(table->entries.begin(), table->entries.end(), search,
+                                      [](const BindingTableEntry& lhs, const BindingTableEntry& rhs) {
+                                        return (lhs.key_bits < rhs.key_bits);
+                                      });
+  return std::span<const BindingTableEntry>(range.first, range.second);
+}
+
+void InputManager::PublishBindingTable()
+{
+  std::unique_ptr<BindingTable> table = std::make_unique<BindingTable>();
+  table->bindings = s_bindings;
+  for (const std::shared_ptr<InputBinding>& binding : s_bindings)
+  {
+    for (u32 i = 0; i < binding->num_keys; i++)
+    {
+      // Dispatch always uses the first key in the chord which matches the event.
+      const InputBindingKey masked_key = binding->keys[i].MaskDirection();
+      u32 key_index = 0;
+      while (binding->keys[key_index].MaskDirection() != masked_key)
+        key_index++;
+
+      BindingTableEntry& entry = table->entries.emplace_back();
+      entry.key_bits = masked_key.bits;
+      entry.binding = binding.get();
+      entry.axis_handler = std::get_if<InputAxisEventHandler>(&binding->handler);
+      entry.button_handler = std::get_if<InputButtonEventHandler>(&binding->handler);
+      entry.key_index = static_cast<u8>(key_index);
+      entry.sub_frame_safe = binding->controller_binding;
+    }
+  }
+
+  // Stable, so bindings for the same key are dispatched in the order they were added.
+  std::stable_sort(table->entries.begin(), table->entries.end(),
+                   [](const BindingTableEntry& lhs, const BindingTableEntry& rhs) {
+                     return (lhs.key_bits < rhs.key_bits);
+                   });
+
+  // Keys which anything other than a controller binding uses. A chord could cancel a binding on any of its keys,
+  // so a controller binding is only safe to fire mid-frame when none of its keys are in this list. Already sorted.
+  std::vector<u64> shared_keys;
+  for (const BindingTableEntry& entry : table->entries)
+  {
+    if (!entry.binding->controller_binding && (shared_keys.empty() || shared_keys.back() != entry.key_bits))
+      shared_keys.push_back(entry.key_bits);
+  }
+  if (!shared_keys.empty())
+  {
+    for (BindingTableEntry& entry : table->entries)
+    {
+      for (u32 i = 0; i < entry.binding->num_keys && entry.sub_frame_safe; i++)
+      {
+        entry.sub_frame_safe =
+          !std::binary_search(shared_keys.begin(), shared_keys.end(), entry.binding->keys[i].MaskDirection().bits);
+      }
+    }
+  }
+
+  std::unique_ptr<BindingTable> old_table = std::exchange(s_current_binding_table, std::move(table));
+  s_binding_table.store(s_current_binding_table.get());
+  if (old_table)
+  {
+    s_retired_binding_tables.push_back(std::move(old_table));
+    s_has_retired_binding_tables.store(true, std::memory_order_relaxed);
+  }
+
+  ReclaimBindingTables();
+}
+
+void InputManager::ReclaimBindingTables()
+{
+  // Retired tables are no longer published, so once the reader count hits zero, nobody can be using them.
+  if (s_retired_binding_tables.empty() || s_binding_table_readers.load() != 0)
+    return;
+
+  s_retired_binding_tables.clear();
+  s_has_retired_binding_tables.store(false, std::memory_order_relaxed);
+}
+
+InputManager::EventStatistics InputManager::GetEventStatistics()
+{
+  EventStatistics stats;
+  stats.num_events = s_event_dispatch_counters.num_events.load(std::memory_order_relaxed);
+  stats.total_time = s_event_dispatch_counters.total_time.load(std::memory_order_relaxed);
+  stats.max_time = s_event_dispatch_counters.max_time.load(std::memory_order_relaxed);
+  stats.num_reads = s_event_dispatch_counters.num_reads.load(std::memory_order_relaxed);
+  stats.total_read_latency = s_event_dispatch_counters.total_read_latency.load(std::memory_order_relaxed);
+  stats.max_read_latency = s_event_dispatch_counters.max_read_latency.load(std::memory_order_relaxed);
+  return stats;
+}
+
+void InputManager::ResetEventStatistics()
 {
-  return std::holds_alternative<InputAxisEventHandler>(handler);
+  s_event_dispatch_counters.num_events.store(0, std::memory_order_relaxed);
+  s_event_dispatch_counters.total_time.store(0, std::memory_order_relaxed);
+  s_event_dispatch_counters.max_time.store(0, std::memory_order_relaxed);
+  s_event_dispatch_counters.num_reads.store(0, std::memory_order_relaxed);
+  s_event_dispatch_counters.total_read_latency.store(0, std::memory_order_relaxed);
+  s_event_dispatch_counters.max_read_latency.store(0, std::memory_order_relaxed);
+}
+
+void InputManager::RecordControllerRead()
+{
+  if (s_unread_controller_input_time == 0)
+    return;
+
+  const u64 latency = Common::Timer::GetCurrentValue() - s_unread_controller_input_time;
+  s_unread_controller_input_time = 0;
+  s_event_dispatch_counters.num_reads.fetch_add(1, std::memory_order_relaxed);
+  s_event_dispatch_counters.total_read_latency.fetch_add(latency, std::memory_order_relaxed);
+  if (latency > s_event_dispatch_counters.max_read_latency.load(std::memory_order_relaxed))
+    s_event_dispatch_counters.max_read_latency.store(latency, std::memory_order_relaxed);
 }
 
 bool InputManager::InvokeEvents(InputBindingKey key, float value, GenericInputBinding generic_key)
@@ -972,143 +1191,165 @@ bool InputManager::InvokeEvents(InputBindingKey key, float value, GenericInputBi
   if (DoEventHook(key, value))
     return true;
 
+  const Common::Timer::Value start_time = Common::Timer::GetCurrentValue();
+
   // If imgui ate the event, don't fire our handlers.
   const bool skip_button_handlers = PreprocessEvent(key, value, generic_key);
-  return ProcessEvent(key, value, skip_button_handlers);
+  const bool result = ProcessEvent(key, value, skip_button_handlers);
+
+  // Only one thread dispatches at a time in practice, so a racy max is good enough.
+  const u64 time = Common::Timer::GetCurrentValue() - start_time;
+  s_event_dispatch_counters.num_events.fetch_add(1, std::memory_order_relaxed);
+  s_event_dispatch_counters.total_time.fetch_add(time, std::memory_order_relaxed);
+  if (time > s_event_dispatch_counters.max_time.load(std::memory_order_relaxed))
+    s_event_dispatch_counters.max_time.store(time, std::memory_order_relaxed);
+
+  return result;
 }
 
 bool InputManager::ProcessEvent(InputBindingKey key, float value, bool skip_button_handlers)
 {
   // find all the bindings associated with this key
+  const BindingTableReadGuard guard;
   const InputBindingKey masked_key = key.MaskDirection();
-  const auto range = s_binding_map.equal_range(masked_key);
-  if (range.first == s_binding_map.end())
+  const std::span<const BindingTableEntry> range = FindBindings(guard.GetTable(), masked_key);
+  if (range.empty())
     return false;
 
+  if (s_in_sub_frame_poll &&
+      std::any_of(range.begin(), range.end(), [](const BindingTableEntry& entry) { return !entry.sub_frame_safe; }))
+  {
+    s_deferred_events.push_back(DeferredInputEvent{key, value, skip_button_handlers, false});
+    return true;
+  }
+
   // Now we can actually fire/activate bindings.
   u32 min_num_keys = 0;
-  for (auto it = range.first; it != range.second; ++it)
+  bool has_controller_bindings = false;
+  for (const BindingTableEntry& entry : range)
   {
-    InputBinding* binding = it->second.get();
-
-    // find the key which matches us
-    for (u32 i = 0; i < binding->num_keys; i++)
-    {
-      if (binding->keys[i].MaskDirection() != masked_key)
-        continue;
+    has_controller_bindings |= entry.binding->controller_binding;
 
-      const u8 bit = static_cast<u8>(1) << i;
-      const bool negative = binding->keys[i].modifier == InputModifier::Negate;
-      const bool new_state = (negative ? (value < 0.0f) : (value > 0.0f));
+    InputBinding* binding = entry.binding;
+    const u32 i = entry.key_index;
+    const u8 bit = static_cast<u8>(1) << i;
+    const bool negative = binding->keys[i].modifier == InputModifier::Negate;
+    const bool new_state = (negative ? (value < 0.0f) : (value > 0.0f));
 
-      float value_to_pass = 0.0f;
-      switch (binding->keys[i].modifier)
-      {
-        case InputModifier::None:
-          if (value > 0.0f)
-            value_to_pass = value;
-          break;
-        case InputModifier::Negate:
-          if (value < 0.0f)
-            value_to_pass = -value;
-          break;
-        case InputModifier::FullAxis:
-          value_to_pass = value * 0.5f + 0.5f;
-          break;
-      }
+    float value_to_pass = 0.0f;
+    switch (binding->keys[i].modifier)
+    {
+      case InputModifier::None:
+        if (value > 0.0f)
+          value_to_pass = value;
+        break;
+      case InputModifier::Negate:
+        if (value < 0.0f)
+          value_to_pass = -value;
+        break;
+      case InputModifier::FullAxis:
+        value_to_pass = value * 0.5f + 0.5f;
+        break;
+    }
 
-      // handle inverting, needed for some wheels.
-      value_to_pass = binding->keys[i].invert ? (1.0f - value_to_pass) : value_to_pass;
+    // handle inverting, needed for some wheels.
+    value_to_pass = binding->keys[i].invert ? (1.0f - value_to_pass) : value_to_pass;
 
-      // axes are fired regardless of a state change, unless they're zero
-      // (but going from not-zero to zero will still fire, because of the full state)
-      // for buttons, we can use the state of the last chord key, because it'll be 1 on press,
-      // and 0 on release (when the full state changes).
-      if (IsAxisHandler(binding->handler))
-      {
-        if (value_to_pass >= 0.0f && (!skip_button_handlers || value_to_pass == 0.0f))
-          std::get<InputAxisEventHandler>(binding->handler)(value_to_pass);
-      }
-      else if (binding->num_keys >= min_num_keys)
+    // axes are fired regardless of a state change, unless they're zero
+    // (but going from not-zero to zero will still fire, because of the full state)
+    // for buttons, we can use the state of the last chord key, because it'll be 1 on press,
+    // and 0 on release (when the full state changes).
+    if (entry.axis_handler)
+    {
+      if (value_to_pass >= 0.0f && (!skip_button_handlers || value_to_pass == 0.0f))
+        (*entry.axis_handler)(value_to_pass);
+    }
+    else if (binding->num_keys >= min_num_keys)
+    {
+      // update state based on whether the whole chord was activated
+      const u8 new_mask =
+        ((new_state && !skip_button_handlers) ? (binding->current_mask | bit) : (binding->current_mask & ~bit));
+      const bool prev_full_state = (binding->current_mask == binding->full_mask);
+      const bool new_full_state = (new_mask == binding->full_mask);
+      binding->current_mask = new_mask;
+
+      // Workaround for multi-key bindings that share the same keys.
+      if (binding->num_keys > 1 && new_full_state && prev_full_state != new_full_state)
       {
-        // update state based on whether the whole chord was activated
-        const u8 new_mask =
-          ((new_state && !skip_button_handlers) ? (binding->current_mask | bit) : (binding->current_mask & ~bit));
-        const bool prev_full_state = (binding->current_mask == binding->full_mask);
-        const bool new_full_state = (new_mask == binding->full_mask);
-        binding->current_mask = new_mask;
-
-        // Workaround for multi-key bindings that share the same keys.
-        if (binding->num_keys > 1 && new_full_state && prev_full_state != new_full_state && range.first != range.second)
+        // Because the binding map isn't ordered, we could iterate in the order of Shift+F1 and then
+        // F1, which would mean that F1 wouldn't get cancelled and still activate. So, to handle this
+        // case, we skip activating any future bindings with a fewer number of keys.
+        min_num_keys = std::max<u32>(min_num_keys, binding->num_keys);
+
+        // Basically, if we bind say, F1 and Shift+F1, and press shift and then F1, we'll fire bindings
+        // for both F1 and Shift+F1, when we really only want to fire the binding for Shift+F1. So,
+        // when we activate a multi-key chord (key press), we go through the binding map for all the
+        // other keys in the chord, and cancel them if they have a shorter chord. If they're longer,
+        // they could still activate and take precedence over us, so we leave them alone.
+        for (u32 j = 0; j < binding->num_keys; j++)
         {
-          // Because the binding map isn't ordered, we could iterate in the order of Shift+F1 and then
-          // F1, which would mean that F1 wouldn't get cancelled and still activate. So, to handle this
-          // case, we skip activating any future bindings with a fewer number of keys.
-          min_num_keys = std::max<u32>(min_num_keys, binding->num_keys);
-
-          // Basically, if we bind say, F1 and Shift+F1, and press shift and then F1, we'll fire bindings
-          // for both F1 and Shift+F1, when we really only want to fire the binding for Shift+F1. So,
-          // when we activate a multi-key chord (key press), we go through the binding map for all the
-          // other keys in the chord, and cancel them if they have a shorter chord. If they're longer,
-          // they could still activate and take precedence over us, so we leave them alone.
-          for (u32 j = 0; j < binding->num_keys; j++)
+          for (const BindingTableEntry& other_entry : FindBindings(guard.GetTable(), binding->keys[j].MaskDirection()))
           {
-            const auto range2 = s_binding_map.equal_range(binding->keys[j].MaskDirection());
-            for (auto it2 = range2.first; it2 != range2.second; ++it2)
+            InputBinding* other_binding = other_entry.binding;
+            if (other_binding == binding || other_entry.axis_handler ||
+                other_binding->num_keys >= binding->num_keys)
             {
-              InputBinding* other_binding = it2->second.get();
-              if (other_binding == binding || IsAxisHandler(other_binding->handler) ||
-                  other_binding->num_keys >= binding->num_keys)
-              {
-                continue;
-              }
-
-              // We only need to cancel the binding if it was fully active before. Which in the above
-              // case of Shift+F1 / F1, it will be.
-              if (other_binding->current_mask == other_binding->full_mask)
-                std::get<InputButtonEventHandler>(other_binding->handler)(-1);
-
-              // Zero out the current bits so that we don't release this binding, if the other part
-              // of the chord releases first.
-              other_binding->current_mask = 0;
+              continue;
             }
-          }
-        }
 
-        if (prev_full_state != new_full_state && binding->num_keys >= min_num_keys)
-        {
-          const s32 pressed = skip_button_handlers ? -1 : static_cast<s32>(value_to_pass > 0.0f);
-          std::get<InputButtonEventHandler>(binding->handler)(pressed);
+            // We only need to cancel the binding if it was fully active before. Which in the above
+            // case of Shift+F1 / F1, it will be.
+            if (other_binding->current_mask == other_binding->full_mask)
+              (*other_entry.button_handler)(-1);
+
+            // Zero out the current bits so that we don't release this binding, if the other part
+            // of the chord releases first.
+            other_binding->current_mask = 0;
+          }
         }
       }
 
-      // bail out, since we shouldn't have the same key twice in the chord
-      break;
+      if (prev_full_state != new_full_state && binding->num_keys >= min_num_keys)
+      {
+        const s32 pressed = skip_button_handlers ? -1 : static_cast<s32>(value_to_pass > 0.0f);
+        (*entry.button_handler)(pressed);
+      }
     }
   }
 
+  // Start the clock for the read latency, only input that the guest can actually see counts.
+  if (has_controller_bindings && s_unread_controller_input_time == 0 && System::IsRunning())
+    s_unread_controller_input_time = Common::Timer::GetCurrentValue();
+
   return true;
 }
 
 void InputManager::ClearBindStateFromSource(InputBindingKey key)
 {
-  // Why are we doing it this way? Because any of the bindings could cause a reload and invalidate our iterators :(.
-  // Axis handlers should be fine, so we'll do those as a first pass.
-  for (const auto& [match_key, binding] : s_binding_map)
+  // Releasing hotkeys mid-frame isn't safe either, and the controller can keep its state until the frame ends.
+  if (s_in_sub_frame_poll)
   {
-    if (key.source_type != match_key.source_type || key.source_subtype != match_key.source_subtype ||
-        key.source_index != match_key.source_index || !IsAxisHandler(binding->handler))
-    {
-      continue;
-    }
+    s_deferred_events.push_back(DeferredInputEvent{key, 0.0f, false, true});
+    return;
+  }
 
-    for (u32 i = 0; i < binding->num_keys; i++)
+  // Axis handlers can't change the bindings, so we'll do those as a first pass.
+  {
+    const BindingTableReadGuard guard;
+    if (!guard.GetTable())
+      return;
+
+    for (const BindingTableEntry& entry : guard.GetTable()->entries)
     {
-      if (binding->keys[i].MaskDirection() != match_key)
+      InputBindingKey match_key;
+      match_key.bits = entry.key_bits;
+      if (key.source_type != match_key.source_type || key.source_subtype != match_key.source_subtype ||
+          key.source_index != match_key.source_index || !entry.axis_handler)
+      {
         continue;
+      }
 
-      std::get<InputAxisEventHandler>(binding->handler)(0.0f);
-      break;
+      (*entry.axis_handler)(0.0f);
     }
   }
 
@@ -1118,39 +1359,37 @@ void InputManager::ClearBindStateFromSource(InputBindingKey key)
   {
     matched = false;
 
-    for (const auto& [match_key, binding] : s_binding_map)
+    // Any of the button handlers could cause a reload, so start again with the new table if one fires.
+    const BindingTableReadGuard guard;
+    if (!guard.GetTable())
+      return;
+
+    for (const BindingTableEntry& entry : guard.GetTable()->entries)
     {
+      InputBindingKey match_key;
+      match_key.bits = entry.key_bits;
       if (key.source_type != match_key.source_type || key.source_subtype != match_key.source_subtype ||
-          key.source_index != match_key.source_index || IsAxisHandler(binding->handler))
+          key.source_index != match_key.source_index || entry.axis_handler)
       {
         continue;
       }
 
-      for (u32 i = 0; i < binding->num_keys; i++)
-      {
-        if (binding->keys[i].MaskDirection() != match_key)
-          continue;
-
-        // Skip if we weren't pressed.
-        const u8 bit = static_cast<u8>(1) << i;
-        if ((binding->current_mask & bit) == 0)
-          continue;
+      // Skip if we weren't pressed.
+      InputBinding* binding = entry.binding;
+      const u8 bit = static_cast<u8>(1) << entry.key_index;
+      if ((binding->current_mask & bit) == 0)
+        continue;
 
-        // Only fire handler if we're changing from active state.
-        const u8 current_mask = binding->current_mask;
-        binding->current_mask &= ~bit;
+      // Only fire handler if we're changing from active state.
+      const u8 current_mask = binding->current_mask;
+      binding->current_mask &= ~bit;
 
-        if (current_mask == binding->full_mask)
-        {
-          std::get<InputButtonEventHandler>(binding->handler)(0);
-          matched = true;
-          break;
-        }
-      }
-
-      // Need to start again, might've reloaded.
-      if (matched)
+      if (current_mask == binding->full_mask)
+      {
+        (*entry.button_handler)(0);
+        matched = true;
         break;
+      }
     }
   } while (matched);
 }
@@ -1302,11 +1541,13 @@ void InputManager::UpdateRelativeMouseMode()
 {
   // Check for relative mode bindings, and enable if there's anything using it.
   bool has_relative_mode_bindings = !s_pointer_move_callbacks.empty();
-  if (!has_relative_mode_bindings)
+  const BindingTableReadGuard guard;
+  if (!has_relative_mode_bindings && guard.GetTable())
   {
-    for (const auto& it : s_binding_map)
+    for (const BindingTableEntry& entry : guard.GetTable()->entries)
     {
-      const InputBindingKey& key = it.first;
+      InputBindingKey key;
+      key.bits = entry.key_bits;
       if (key.source_type == InputSourceType::Pointer && key.source_subtype == InputSubclass::PointerAxis &&
           key.data >= static_cast<u32>(InputPointerAxis::X) && key.data <= static_cast<u32>(InputPointerAxis::Y))
       {
@@ -1818,7 +2059,8 @@ void InputManager::ReloadBindings(SettingsInterface& binding_si, SettingsInterfa
 
   std::unique_lock lock(s_binding_map_write_lock);
 
-  s_binding_map.clear();
+  s_bindings.clear();
+  s_reloading_bindings = true;
   s_pad_vibration_array.clear();
   s_pointer_move_callbacks.clear();
 
@@ -1850,6 +2092,9 @@ void InputManager::ReloadBindings(SettingsInterface& binding_si, SettingsInterfa
                       1.0f);
   }
 
+  s_reloading_bindings = false;
+  PublishBindingTable();
+
   UpdateRelativeMouseMode();
 }
 
@@ -1882,17 +2127,22 @@ void InputManager::CloseSources()
       s_input_sources[i].reset();
     }
   }
+
+  s_deferred_events.clear();
 }
 
 void InputManager::PollSources()
 {
-  for (u32 i = FIRST_EXTERNAL_INPUT_SOURCE; i < LAST_EXTERNAL_INPUT_SOURCE; i++)
+  // Tables retired while a handler was running are freed here, since nothing should be dispatching now.
+  if (s_has_retired_binding_tables.load(std::memory_order_relaxed))
   {
-    if (s_input_sources[i])
-      s_input_sources[i]->PollEvents();
+    std::unique_lock lock(s_binding_map_write_lock, std::try_to_lock);
+    if (lock.owns_lock())
+      ReclaimBindingTables();
   }
 
-  GenerateRelativeMouseEvents();
+  ReplayDeferredEvents();
+  PollSourceEvents();
 
   if (System::GetState() == System::State::Running)
   {
@@ -1902,6 +2152,49 @@ void InputManager::PollSources()
   }
 }
 
+void InputManager::PollSourcesForSubFrame()
+{
+  s_in_sub_frame_poll = true;
+  PollSourceEvents();
+  s_in_sub_frame_poll = false;
+}
+
+void InputManager::PollSourceEvents()
+{
+  for (u32 i = FIRST_EXTERNAL_INPUT_SOURCE; i < LAST_EXTERNAL_INPUT_SOURCE; i++)
+  {
+    if (s_input_sources[i])
+      s_input_sources[i]->PollEvents();
+  }
+
+  GenerateRelativeMouseEvents();
+
+  s_last_poll_time = Common::Timer::GetCurrentValue();
+}
+
+void InputManager::ReplayDeferredEvents()
+{
+  if (s_deferred_events.empty())
+    return;
+
+  // Handlers can reload bindings or even shut down the system, so take ownership of the queue first.
+  std::vector<DeferredInputEvent> events;
+  events.swap(s_deferred_events);
+
+  for (const DeferredInputEvent& event : events)
+  {
+    if (event.clear_bind_state)
+      ClearBindStateFromSource(event.key);
+    else
+      ProcessEvent(event.key, event.value, event.skip_button_handlers);
+  }
+}
+
+u64 InputManager::GetLastPollTime()
+{
+  return s_last_poll_time;
+}
+
 std::vector<std::pair<std::string, std::string>> InputManager::EnumerateDevices()
 {
   std::vector<std::pair<std::string, std::string>> ret;
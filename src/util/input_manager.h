@@ -268,6 +268,16 @@ void CloseSources();
 /// Polls input sources for events (e.g. external controllers).
 void PollSources();
 
+/// Polls input sources in the middle of a frame, i.e. when the guest is about to read the controllers.
+/// Only controller bindings are fired, anything else (e.g. hotkeys) is deferred to the next PollSources().
+void PollSourcesForSubFrame();
+
+/// Returns the time of the last poll of the input sources, from either PollSources() or PollSourcesForSubFrame().
+u64 GetLastPollTime();
+
+/// Records that the guest has read the controllers, for measuring how long new input waits before it is seen.
+void RecordControllerRead();
+
 /// Returns true if any bindings exist for the specified key.
 /// Can be safely called on another thread.
 bool HasAnyBindingsForKey(InputBindingKey key);
@@ -280,7 +290,8 @@ bool HasAnyBindingsForSource(InputBindingKey key);
 bool ParseBindingAndGetSource(std::string_view binding, InputBindingKey* key, InputSource** source);
 
 /// Externally adds a fixed binding. Be sure to call *after* ReloadBindings() otherwise it will be lost.
-void AddBinding(std::string_view binding, const InputEventHandler& handler);
+/// Controller bindings are the only bindings which are fired when polling in the middle of a frame.
+void AddBinding(std::string_view binding, const InputEventHandler& handler, bool controller_binding = false);
 
 /// Adds an external vibration binding.
 void AddVibrationBinding(u32 pad_index, const InputBindingKey* motor_0_binding, InputSource* motor_0_source,
@@ -293,6 +304,24 @@ bool InvokeEvents(InputBindingKey key, float value, GenericInputBinding generic_
 /// Clears internal state for any binds with a matching source/index.
 void ClearBindStateFromSource(InputBindingKey key);
 
+/// Time spent dispatching events to their bindings, and time between controller input arriving and the guest
+/// reading it, in timer ticks.
+struct EventStatistics
+{
+  u64 num_events;
+  u64 total_time;
+  u64 max_time;
+  u64 num_reads;
+  u64 total_read_latency;
+  u64 max_read_latency;
+};
+
+/// Returns the dispatch counters accumulated since the last reset.
+EventStatistics GetEventStatistics();
+
+/// Clears the dispatch counters.
+void ResetEventStatistics();
+
 /// Sets a hook which can be used to intercept events before they're processed by the normal bindings.
 /// This is typically used when binding new controls to detect what gets pressed.
 void SetHook(InputInterceptHook::Callback callback);
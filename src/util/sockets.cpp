@@ -6,6 +6,7 @@
 
 #include "common/assert.h"
 #include "common/log.h"
+#include "common/threading.h"
 
 #include <algorithm>
 #include <cstring>
@@ -225,18 +226,34 @@ BaseSocket::BaseSocket(SocketMultiplexer& multiplexer, SocketDescriptor descript
 
 BaseSocket::~BaseSocket() = default;
 
+void BaseSocket::OnDeferredEvents(u32 events)
+{
+}
+
 SocketMultiplexer::SocketMultiplexer() = default;
 
 SocketMultiplexer::~SocketMultiplexer()
 {
+  StopIOThread();
   CloseAll();
 
+  // nobody is left to receive these
+  DeferredSocketNode* node = m_deferred_sockets.exchange(nullptr, std::memory_order_acquire);
+  while (node)
+  {
+    DeferredSocketNode* next = node->next;
+    delete node;
+    node = next;
+  }
+
 #ifdef __linux__
   if (m_epoll_fd >= 0)
     close(m_epoll_fd);
 #else
   if (m_poll_array)
     std::free(m_poll_array);
+  if (m_io_thread_poll_array)
+    std::free(m_io_thread_poll_array);
 #endif
 }
 
@@ -438,7 +455,10 @@ void SocketMultiplexer::CloseAll()
 void SocketMultiplexer::SetNotificationMask(BaseSocket* socket, SocketDescriptor descriptor, u32 events)
 {
 #ifdef __linux__
-  struct epoll_event ev = {.events = events, .data = {.fd = descriptor}};
+  // The I/O thread drains sockets completely on each event, so it can use edge triggering.
+  // Modifying the mask re-arms the trigger, which is how stalled reads are resumed.
+  const u32 epoll_events = (m_use_io_thread && events != 0) ? (events | EPOLLET) : events;
+  struct epoll_event ev = {.events = epoll_events, .data = {.fd = descriptor}};
   if (epoll_ctl(m_epoll_fd, EPOLL_CTL_MOD, descriptor, &ev) != 0) [[unlikely]]
     ERROR_LOG("epoll_ctl() for events 0x{:x} failed: {}", events, Error::CreateErrno(errno).GetDescription());
 #else
@@ -486,6 +506,113 @@ void SocketMultiplexer::SetNotificationMask(BaseSocket* socket, SocketDescriptor
 }
 
 bool SocketMultiplexer::PollEventsWithTimeout(u32 milliseconds)
+{
+  if (!m_use_io_thread)
+    return PollSocketEvents(milliseconds);
+
+  if (!m_deferred_sockets.load(std::memory_order_relaxed) && milliseconds > 0)
+  {
+    std::unique_lock lock(m_deferred_wait_lock);
+    m_deferred_waiting.store(true);
+    m_deferred_wait_cv.wait_for(lock, std::chrono::milliseconds(milliseconds),
+                                [this]() { return (m_deferred_sockets.load() != nullptr); });
+    m_deferred_waiting.store(false);
+  }
+
+  return DispatchDeferredEvents();
+}
+
+void SocketMultiplexer::StartIOThread()
+{
+  DebugAssert(!m_use_io_thread && !HasAnyOpenSockets());
+  m_use_io_thread = true;
+  m_io_thread_shutdown.store(false, std::memory_order_release);
+  m_io_thread = std::thread(&SocketMultiplexer::IOThreadEntryPoint, this);
+}
+
+void SocketMultiplexer::StopIOThread()
+{
+  if (!m_io_thread.joinable())
+    return;
+
+  m_io_thread_shutdown.store(true, std::memory_order_release);
+  m_io_thread.join();
+}
+
+bool SocketMultiplexer::IsOnIOThread() const
+{
+  return (m_use_io_thread && std::this_thread::get_id() == m_io_thread.get_id());
+}
+
+void SocketMultiplexer::IOThreadEntryPoint()
+{
+  Threading::SetNameOfCurrentThread("Socket I/O Thread");
+
+  // epoll picks up mask changes while waiting, the timeout is only for noticing shutdown.
+  // poll() doesn't, so that needs a shorter interval for newly-registered write notifications.
+#ifdef __linux__
+  static constexpr u32 POLL_TIMEOUT_MS = 100;
+#else
+  static constexpr u32 POLL_TIMEOUT_MS = 10;
+#endif
+
+  while (!m_io_thread_shutdown.load(std::memory_order_acquire))
+  {
+    if (!PollSocketEvents(POLL_TIMEOUT_MS) && !HasAnyOpenSockets())
+      std::this_thread::sleep_for(std::chrono::milliseconds(POLL_TIMEOUT_MS));
+  }
+}
+
+void SocketMultiplexer::QueueDeferredEvents(BaseSocket* socket, u32 events)
+{
+  // already in the list?
+  if (socket->m_deferred_events.fetch_or(events, std::memory_order_acq_rel) != 0)
+    return;
+
+  DeferredSocketNode* node = new DeferredSocketNode{socket->shared_from_this(), m_deferred_sockets.load()};
+  while (!m_deferred_sockets.compare_exchange_weak(node->next, node))
+    ;
+
+  if (m_deferred_waiting.load())
+  {
+    std::unique_lock lock(m_deferred_wait_lock);
+    m_deferred_wait_cv.notify_one();
+  }
+}
+
+bool SocketMultiplexer::DispatchDeferredEvents()
+{
+  DeferredSocketNode* node = m_deferred_sockets.exchange(nullptr, std::memory_order_acquire);
+  if (!node)
+    return false;
+
+  // list is in reverse order, flip it so events are delivered in the order they happened
+  DeferredSocketNode* prev = nullptr;
+  while (node)
+  {
+    DeferredSocketNode* next = node->next;
+    node->next = prev;
+    prev = node;
+    node = next;
+  }
+
+  node = prev;
+  while (node)
+  {
+    // anything raised after this point queues the socket again
+    const u32 events = node->socket->m_deferred_events.exchange(0, std::memory_order_acq_rel);
+    if (events != 0)
+      node->socket->OnDeferredEvents(events);
+
+    DeferredSocketNode* next = node->next;
+    delete node;
+    node = next;
+  }
+
+  return true;
+}
+
+bool SocketMultiplexer::PollSocketEvents(u32 milliseconds)
 {
 #ifdef __linux__
   constexpr int MAX_EVENTS = 128;
@@ -544,7 +671,27 @@ bool SocketMultiplexer::PollEventsWithTimeout(u32 milliseconds)
   if (m_poll_array_active_size == 0)
     return false;
 
-  const int res = WSAPoll(m_poll_array, static_cast<nfds_t>(m_poll_array_active_size), milliseconds);
+  // The I/O thread polls a copy, so other threads can change their masks while it's waiting.
+  pollfd* poll_array = m_poll_array;
+  const size_t poll_array_size = m_poll_array_active_size;
+  if (m_use_io_thread)
+  {
+    if (m_io_thread_poll_array_size < poll_array_size)
+    {
+      pollfd* new_array = static_cast<pollfd*>(std::realloc(m_io_thread_poll_array, sizeof(pollfd) * poll_array_size));
+      if (!new_array)
+        Panic("Memory allocation failed.");
+
+      m_io_thread_poll_array = new_array;
+      m_io_thread_poll_array_size = poll_array_size;
+    }
+
+    std::memcpy(m_io_thread_poll_array, m_poll_array, sizeof(pollfd) * poll_array_size);
+    poll_array = m_io_thread_poll_array;
+    lock.unlock();
+  }
+
+  const int res = WSAPoll(poll_array, static_cast<nfds_t>(poll_array_size), milliseconds);
   if (res <= 0)
     return false;
 
@@ -555,9 +702,9 @@ bool SocketMultiplexer::PollEventsWithTimeout(u32 milliseconds)
   size_t num_triggered_sockets = 0;
   {
     std::unique_lock open_lock(m_open_sockets_lock);
-    for (size_t i = 0; i < m_poll_array_active_size; i++)
+    for (size_t i = 0; i < poll_array_size; i++)
     {
-      const pollfd& pfd = m_poll_array[i];
+      const pollfd& pfd = poll_array[i];
       if (pfd.revents == 0)
         continue;
 
@@ -575,7 +722,8 @@ bool SocketMultiplexer::PollEventsWithTimeout(u32 milliseconds)
   }
 
   // release lock so connections etc can acquire it
-  lock.unlock();
+  if (lock.owns_lock())
+    lock.unlock();
 
   // fire events
   for (size_t i = 0; i < num_triggered_sockets; i++)
@@ -631,34 +779,41 @@ void ListenSocket::Close()
 
 void ListenSocket::OnReadEvent()
 {
-  // connection incoming
-  sockaddr_storage sa;
-  socklen_t salen = sizeof(sa);
-  SocketDescriptor new_descriptor = accept(m_descriptor, reinterpret_cast<sockaddr*>(&sa), &salen);
-  if (new_descriptor == INVALID_SOCKET)
+  // accept until the backlog is empty, required for edge-triggered notifications
+  for (;;)
   {
-    ERROR_LOG("accept() returned {}", Error::CreateSocket(WSAGetLastError()).GetDescription());
-    return;
-  }
+    // connection incoming
+    sockaddr_storage sa;
+    socklen_t salen = sizeof(sa);
+    SocketDescriptor new_descriptor = accept(m_descriptor, reinterpret_cast<sockaddr*>(&sa), &salen);
+    if (new_descriptor == INVALID_SOCKET)
+    {
+      const int error_code = WSAGetLastError();
+      if (error_code != WSAEWOULDBLOCK)
+        ERROR_LOG("accept() returned {}", Error::CreateSocket(error_code).GetDescription());
 
-  Error error;
-  if (!SetNonBlocking(new_descriptor, &error))
-  {
-    ERROR_LOG("Failed to set just-connected socket to nonblocking: {}", error.GetDescription());
-    closesocket(new_descriptor);
-    return;
-  }
+      return;
+    }
 
-  // create socket, we release our own reference.
-  std::shared_ptr<StreamSocket> client = m_accept_callback(m_multiplexer, new_descriptor);
-  if (!client)
-  {
-    closesocket(new_descriptor);
-    return;
-  }
+    Error error;
+    if (!SetNonBlocking(new_descriptor, &error))
+    {
+      ERROR_LOG("Failed to set just-connected socket to nonblocking: {}", error.GetDescription());
+      closesocket(new_descriptor);
+      continue;
+    }
 
-  m_num_connections_accepted++;
-  client->InitialSetup();
+    // create socket, we release our own reference.
+    std::shared_ptr<StreamSocket> client = m_accept_callback(m_multiplexer, new_descriptor);
+    if (!client)
+    {
+      closesocket(new_descriptor);
+      continue;
+    }
+
+    m_num_connections_accepted++;
+    client->InitialSetup();
+  }
 }
 
 void ListenSocket::OnWriteEvent()
@@ -705,7 +860,7 @@ void StreamSocket::InitialSetup()
 
   // trigger connected notification
   std::unique_lock lock(m_lock);
-  OnConnected();
+  NotifyConnected();
 }
 
 size_t StreamSocket::Read(void* buffer, size_t buffer_size)
@@ -835,7 +990,17 @@ void StreamSocket::Close()
 {
   std::unique_lock lock(m_lock);
   if (!m_connected)
+  {
+    // closed on the I/O thread, but the owner hasn't been told yet
+    const u32 events = m_deferred_events.load(std::memory_order_acquire);
+    if (events & DEFERRED_EVENT_DISCONNECTED)
+    {
+      m_deferred_events.fetch_and(~DEFERRED_EVENT_DISCONNECTED, std::memory_order_acq_rel);
+      OnDisconnected(m_disconnect_error);
+    }
+
     return;
+  }
 
   m_multiplexer.SetNotificationMask(this, m_descriptor, 0);
   m_multiplexer.RemoveClientSocket(this);
@@ -865,7 +1030,55 @@ void StreamSocket::CloseWithError()
   m_descriptor = INVALID_SOCKET;
   m_connected = false;
 
-  OnDisconnected(error);
+  NotifyDisconnected(error);
+}
+
+void StreamSocket::NotifyConnected()
+{
+  if (m_multiplexer.IsOnIOThread())
+    m_multiplexer.QueueDeferredEvents(this, DEFERRED_EVENT_CONNECTED);
+  else
+    OnConnected();
+}
+
+void StreamSocket::NotifyRead()
+{
+  if (m_multiplexer.IsOnIOThread())
+    m_multiplexer.QueueDeferredEvents(this, DEFERRED_EVENT_READ);
+  else
+    OnRead();
+}
+
+void StreamSocket::NotifyDisconnected(const Error& error)
+{
+  if (m_multiplexer.IsOnIOThread())
+  {
+    m_disconnect_error = error;
+    m_multiplexer.QueueDeferredEvents(this, DEFERRED_EVENT_DISCONNECTED);
+  }
+  else
+  {
+    OnDisconnected(error);
+  }
+}
+
+void StreamSocket::OnDeferredEvents(u32 events)
+{
+  std::unique_lock lock(m_lock);
+  if (events & DEFERRED_EVENT_CONNECTED)
+    OnConnected();
+
+  if ((events & DEFERRED_EVENT_READ) && m_connected)
+  {
+    OnRead();
+
+    // re-arm the edge trigger, OnRead() may not have drained the socket
+    if (m_connected)
+      m_multiplexer.SetNotificationMask(this, m_descriptor, POLLIN);
+  }
+
+  if (events & DEFERRED_EVENT_DISCONNECTED)
+    OnDisconnected(m_disconnect_error);
 }
 
 void StreamSocket::OnReadEvent()
@@ -873,7 +1086,7 @@ void StreamSocket::OnReadEvent()
   // forward through
   std::unique_lock lock(m_lock);
   if (m_connected)
-    OnRead();
+    NotifyRead();
 }
 
 void StreamSocket::OnWriteEvent()
@@ -893,7 +1106,7 @@ void StreamSocket::OnHangupEvent()
   m_descriptor = INVALID_SOCKET;
   m_connected = false;
 
-  OnDisconnected(Error::CreateString("Connection closed by peer."));
+  NotifyDisconnected(Error::CreateString("Connection closed by peer."));
 }
 
 BufferedStreamSocket::BufferedStreamSocket(SocketMultiplexer& multiplexer, SocketDescriptor descriptor,
@@ -929,6 +1142,9 @@ void BufferedStreamSocket::ReleaseReadBuffer(size_t bytes_consumed)
 
 std::span<u8> BufferedStreamSocket::AcquireWriteBuffer(size_t wanted_bytes, bool allow_smaller /* = false */)
 {
+  // The I/O thread moves the send buffer and closes the descriptor under the lock. Callers outside of OnRead() must
+  // hold GetLock() until ReleaseWriteBuffer(), otherwise the returned span can be invalidated.
+  std::unique_lock lock(m_lock);
   if (!m_connected)
     return {};
 
@@ -953,34 +1169,41 @@ std::span<u8> BufferedStreamSocket::AcquireWriteBuffer(size_t wanted_bytes, bool
 
 void BufferedStreamSocket::ReleaseWriteBuffer(size_t bytes_written, bool commit /* = true */)
 {
+  std::unique_lock lock(m_lock);
   if (!m_connected)
     return;
 
   DebugAssert((m_send_buffer_offset + m_send_buffer_size + bytes_written) <= m_send_buffer.size());
   m_send_buffer_size += static_cast<u32>(bytes_written);
 
-  // Send as much as we can.
-  if (commit && m_send_buffer_size > 0)
+  // Send as much as we can. Replies written while handling deferred events are sent together afterwards.
+  if (commit && m_send_buffer_size > 0 && !m_in_deferred_dispatch)
+    FlushSendBuffer();
+}
+
+void BufferedStreamSocket::FlushSendBuffer()
+{
+  // Lock must be held, so the descriptor can't be closed underneath us.
+  DebugAssert(m_connected);
+  const ssize_t res = send(m_descriptor, reinterpret_cast<const char*>(m_send_buffer.data() + m_send_buffer_offset),
+                           SIZE_CAST(m_send_buffer_size), 0);
+  if (res < 0 && WSAGetLastError() != WSAEWOULDBLOCK)
   {
-    const ssize_t res = send(m_descriptor, reinterpret_cast<const char*>(m_send_buffer.data() + m_send_buffer_offset),
-                             SIZE_CAST(m_send_buffer_size), 0);
-    if (res < 0 && WSAGetLastError() != WSAEWOULDBLOCK)
-    {
-      CloseWithError();
-      return;
-    }
+    CloseWithError();
+    return;
+  }
 
-    m_send_buffer_offset += static_cast<size_t>(res);
-    m_send_buffer_size -= static_cast<size_t>(res);
-    if (m_send_buffer_size == 0)
-    {
-      m_send_buffer_offset = 0;
-    }
-    else
-    {
-      // Register for writes to finish it off.
-      m_multiplexer.SetNotificationMask(this, m_descriptor, POLLIN | POLLOUT);
-    }
+  const size_t bytes_sent = (res > 0) ? static_cast<size_t>(res) : 0;
+  m_send_buffer_offset += bytes_sent;
+  m_send_buffer_size -= bytes_sent;
+  if (m_send_buffer_size == 0)
+  {
+    m_send_buffer_offset = 0;
+  }
+  else
+  {
+    // Register for writes to finish it off.
+    m_multiplexer.SetNotificationMask(this, m_descriptor, POLLIN | POLLOUT);
   }
 }
 
@@ -999,6 +1222,7 @@ size_t BufferedStreamSocket::Read(void* buffer, size_t buffer_size)
 
 size_t BufferedStreamSocket::Write(const void* buffer, size_t buffer_size)
 {
+  std::unique_lock lock(m_lock);
   if (!m_connected)
     return 0;
 
@@ -1015,6 +1239,7 @@ size_t BufferedStreamSocket::Write(const void* buffer, size_t buffer_size)
 
 size_t BufferedStreamSocket::WriteVector(const void** buffers, const size_t* buffer_lengths, size_t num_buffers)
 {
+  std::unique_lock lock(m_lock);
   if (!m_connected || num_buffers == 0)
     return 0;
 
@@ -1042,6 +1267,7 @@ size_t BufferedStreamSocket::WriteVector(const void** buffers, const size_t* buf
 
 void BufferedStreamSocket::Close()
 {
+  std::unique_lock lock(m_lock);
   StreamSocket::Close();
 
   m_receive_buffer_offset = 0;
@@ -1056,6 +1282,52 @@ void BufferedStreamSocket::OnReadEvent()
   if (!m_connected)
     return;
 
+  // On the I/O thread, keep reading until the socket is drained, and let the owner consume it later.
+  if (m_multiplexer.IsOnIOThread())
+  {
+    for (;;)
+    {
+      size_t buffer_space = m_receive_buffer.size() - m_receive_buffer_offset - m_receive_buffer_size;
+      if (buffer_space == 0 && m_receive_buffer_offset > 0)
+      {
+        std::memmove(m_receive_buffer.data(), m_receive_buffer.data() + m_receive_buffer_offset, m_receive_buffer_size);
+        m_receive_buffer_offset = 0;
+        buffer_space = m_receive_buffer.size() - m_receive_buffer_size;
+      }
+      if (buffer_space == 0)
+      {
+        // Owner hasn't caught up yet, resumed once it has consumed some of the buffer.
+        m_receive_stalled = true;
+#ifndef __linux__
+        // poll() is level-triggered, stop listening for reads or we'll spin until then.
+        m_multiplexer.SetNotificationMask(this, m_descriptor, (m_send_buffer_size > 0) ? POLLOUT : 0);
+#endif
+        break;
+      }
+
+      const ssize_t res =
+        recv(m_descriptor,
+             reinterpret_cast<char*>(m_receive_buffer.data() + m_receive_buffer_offset + m_receive_buffer_size),
+             SIZE_CAST(buffer_space), 0);
+      if (res == 0 || (res < 0 && WSAGetLastError() != WSAEWOULDBLOCK))
+      {
+        CloseWithError();
+        return;
+      }
+      else if (res < 0)
+      {
+        break;
+      }
+
+      m_receive_buffer_size += static_cast<size_t>(res);
+    }
+
+    if (m_receive_buffer_size > 0)
+      NotifyRead();
+
+    return;
+  }
+
   // Pull as many bytes as possible into the read buffer.
   for (;;)
   {
@@ -1113,13 +1385,17 @@ void BufferedStreamSocket::OnWriteEvent()
       return;
     }
 
-    m_send_buffer_offset += static_cast<size_t>(res);
-    m_send_buffer_size -= static_cast<size_t>(res);
+    const size_t bytes_sent = (res > 0) ? static_cast<size_t>(res) : 0;
+    m_send_buffer_offset += bytes_sent;
+    m_send_buffer_size -= bytes_sent;
     if (m_send_buffer_size == 0)
       m_send_buffer_offset = 0;
   }
 
-  OnWrite();
+  if (m_multiplexer.IsOnIOThread())
+    m_multiplexer.QueueDeferredEvents(this, DEFERRED_EVENT_WRITE);
+  else
+    OnWrite();
 
   if (m_send_buffer_size == 0)
   {
@@ -1128,6 +1404,36 @@ void BufferedStreamSocket::OnWriteEvent()
   }
 }
 
+void BufferedStreamSocket::OnDeferredEvents(u32 events)
+{
+  std::unique_lock lock(m_lock);
+  if (events & DEFERRED_EVENT_CONNECTED)
+    OnConnected();
+
+  m_in_deferred_dispatch = true;
+  if (m_connected && (events & DEFERRED_EVENT_READ))
+    OnRead();
+  if (m_connected && (events & DEFERRED_EVENT_WRITE))
+    OnWrite();
+  m_in_deferred_dispatch = false;
+
+  if (m_connected)
+  {
+    // replies to every request in this batch go out in one send
+    if (m_send_buffer_size > 0)
+      FlushSendBuffer();
+
+    if (m_connected && m_receive_stalled)
+    {
+      m_receive_stalled = false;
+      m_multiplexer.SetNotificationMask(this, m_descriptor, (m_send_buffer_size > 0) ? (POLLIN | POLLOUT) : POLLIN);
+    }
+  }
+
+  if (events & DEFERRED_EVENT_DISCONNECTED)
+    OnDisconnected(m_disconnect_error);
+}
+
 void BufferedStreamSocket::OnWrite()
 {
 }
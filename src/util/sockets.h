@@ -9,11 +9,14 @@
 #include "common/threading.h"
 #include "common/types.h"
 
+#include <atomic>
+#include <condition_variable>
 #include <map>
 #include <memory>
 #include <mutex>
 #include <optional>
 #include <span>
+#include <thread>
 #include <unordered_map>
 
 #ifdef _WIN32
@@ -77,18 +80,27 @@ public:
   virtual void Close() = 0;
 
 protected:
+  // Notifications which are raised on the I/O thread, and delivered on the thread calling PollEventsWithTimeout().
+  enum : u32
+  {
+    DEFERRED_EVENT_CONNECTED = (1u << 0),
+    DEFERRED_EVENT_READ = (1u << 1),
+    DEFERRED_EVENT_WRITE = (1u << 2),
+    DEFERRED_EVENT_DISCONNECTED = (1u << 3),
+  };
+
   virtual void OnReadEvent() = 0;
   virtual void OnWriteEvent() = 0;
   virtual void OnHangupEvent() = 0;
+  virtual void OnDeferredEvents(u32 events);
 
   SocketMultiplexer& m_multiplexer;
   SocketDescriptor m_descriptor;
+  std::atomic<u32> m_deferred_events{0};
 };
 
 class SocketMultiplexer final
 {
-  // TODO: Re-introduce worker threads.
-
 public:
   typedef std::shared_ptr<StreamSocket> (*CreateStreamSocketCallback)(SocketMultiplexer& multiplexer,
                                                                       SocketDescriptor descriptor);
@@ -122,8 +134,16 @@ public:
   void CloseAll();
 
   // Poll for events. Returns false if there are no sockets registered.
+  // When the I/O thread is running, this only delivers the callbacks for events it has already processed, and never
+  // makes a system call if there is nothing pending.
   bool PollEventsWithTimeout(u32 milliseconds);
 
+  // Moves all socket I/O onto a dedicated thread. Must be called before any sockets are created.
+  void StartIOThread();
+
+  // Returns true if socket I/O is performed on a dedicated thread.
+  ALWAYS_INLINE bool IsUsingIOThread() const { return m_use_io_thread; }
+
 protected:
   // Internal interface
   std::shared_ptr<ListenSocket> InternalCreateListenSocket(const SocketAddress& address,
@@ -147,7 +167,23 @@ private:
   // Register for notifications
   void SetNotificationMask(BaseSocket* socket, SocketDescriptor descriptor, u32 events);
 
+  // Waits for readiness events on the sockets, and calls the event handlers.
+  bool PollSocketEvents(u32 milliseconds);
+
+  // I/O thread.
+  bool IsOnIOThread() const;
+  void IOThreadEntryPoint();
+  void StopIOThread();
+  void QueueDeferredEvents(BaseSocket* socket, u32 events);
+  bool DispatchDeferredEvents();
+
 private:
+  struct DeferredSocketNode
+  {
+    std::shared_ptr<BaseSocket> socket;
+    DeferredSocketNode* next;
+  };
+
   // We store the fd in the struct to avoid the cache miss reading the object.
   using SocketMap = std::unordered_map<SocketDescriptor, std::shared_ptr<BaseSocket>>;
 
@@ -158,11 +194,25 @@ private:
   pollfd* m_poll_array = nullptr;
   size_t m_poll_array_active_size = 0;
   size_t m_poll_array_max_size = 0;
+
+  // Copy of the poll array used by the I/O thread, so the lock isn't held while waiting.
+  pollfd* m_io_thread_poll_array = nullptr;
+  size_t m_io_thread_poll_array_size = 0;
 #endif
 
   std::mutex m_open_sockets_lock;
   SocketMap m_open_sockets;
   std::atomic_size_t m_client_socket_count{0};
+
+  // Sockets with callbacks waiting to be delivered. Pushed by the I/O thread, popped all at once by the poller.
+  std::atomic<DeferredSocketNode*> m_deferred_sockets{nullptr};
+  std::mutex m_deferred_wait_lock;
+  std::condition_variable m_deferred_wait_cv;
+  std::atomic_bool m_deferred_waiting{false};
+
+  std::thread m_io_thread;
+  std::atomic_bool m_io_thread_shutdown{false};
+  bool m_use_io_thread = false;
 };
 
 template<class T>
@@ -241,9 +291,16 @@ protected:
   virtual void OnReadEvent() override;
   virtual void OnWriteEvent() override;
   virtual void OnHangupEvent() override;
+  virtual void OnDeferredEvents(u32 events) override;
 
   void CloseWithError();
 
+  // Calls the handler directly, or defers it to the polling thread if we're on the I/O thread.
+  // Must be called with the lock held.
+  void NotifyConnected();
+  void NotifyRead();
+  void NotifyDisconnected(const Error& error);
+
 private:
   void InitialSetup();
 
@@ -251,6 +308,7 @@ private:
   SocketAddress m_remote_address = {};
   std::recursive_mutex m_lock;
   bool m_connected = true;
+  Error m_disconnect_error;
 
   // Ugly, but needed in order to call the events.
   friend SocketMultiplexer;
@@ -281,9 +339,13 @@ public:
 protected:
   void OnReadEvent() override final;
   void OnWriteEvent() override final;
+  void OnDeferredEvents(u32 events) override final;
   virtual void OnWrite();
 
 private:
+  // Sends as much of the send buffer as possible, registering for write notifications if it doesn't all fit.
+  void FlushSendBuffer();
+
   std::vector<u8> m_receive_buffer;
   size_t m_receive_buffer_offset = 0;
   size_t m_receive_buffer_size = 0;
@@ -291,4 +353,10 @@ private:
   std::vector<u8> m_send_buffer;
   size_t m_send_buffer_offset = 0;
   size_t m_send_buffer_size = 0;
+
+  // Set while callbacks are being delivered on the polling thread, so writes are sent once afterwards.
+  bool m_in_deferred_dispatch = false;
+
+  // Receive buffer filled up on the I/O thread, reads resume once the data has been consumed.
+  bool m_receive_stalled = false;
 };